@@ -266,16 +266,199 @@ void * DETEX_RESTRICT source, int numel)
 }
 
 
+//-----------------------------------------------------------------------------
+//
+// Bulk SIMD conversion, eight values per iteration.
+//
+// Both directions produce exactly the same bit patterns as halfp2singles and
+// singles2halfp above (including the canonical NaN they emit), so callers can
+// not tell which path ran. The scalar routines handle any remaining tail.
+//
+// Half to float uses F16C (vcvtph2ps) when the CPU and OS support it, with an
+// SSE2 integer fallback. Float to half only has the SSE2 path since vcvtps2ph
+// rounds to nearest-even, while singles2halfp rounds half away from zero.
+//
+//-----------------------------------------------------------------------------
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+#define DETEX_HALF_FLOAT_SIMD 1
+
+#include <emmintrin.h>
+#include <immintrin.h>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define DETEX_TARGET_F16C
+#else
+#include <cpuid.h>
+#define DETEX_TARGET_F16C __attribute__((target("avx,f16c")))
+#endif
+
+#define DETEX_HALF_FLOAT_CANONICAL_NAN 0xFFC00000u
+
+static bool detexDetectF16C() {
+	unsigned int regs[4] = { 0, 0, 0, 0 };
+#if defined(_MSC_VER)
+	int info[4];
+	__cpuid(info, 1);
+	for (int i = 0; i < 4; i++)
+		regs[i] = (unsigned int)info[i];
+#else
+	if (!__get_cpuid(1, &regs[0], &regs[1], &regs[2], &regs[3]))
+		return false;
+#endif
+	const bool has_osxsave = (regs[2] & (1u << 27)) != 0;
+	const bool has_avx = (regs[2] & (1u << 28)) != 0;
+	const bool has_f16c = (regs[2] & (1u << 29)) != 0;
+	if (!has_osxsave || !has_avx || !has_f16c)
+		return false;
+	// The OS has to save the YMM state as well.
+#if defined(_MSC_VER)
+	const unsigned long long xcr0 = _xgetbv(0);
+#else
+	unsigned int xcr0_lo, xcr0_hi;
+	__asm__ volatile("xgetbv" : "=a"(xcr0_lo), "=d"(xcr0_hi) : "c"(0));
+	const unsigned long long xcr0 = ((unsigned long long)xcr0_hi << 32) | xcr0_lo;
+#endif
+	return (xcr0 & 0x6) == 0x6;
+}
+
+static bool detexHasF16C() {
+	static const bool has_f16c = detexDetectF16C();
+	return has_f16c;
+}
+
+// Overwrites the lanes holding a half NaN with the canonical NaN of halfp2singles.
+static DETEX_INLINE_ONLY void detexFixupHalfNaNs(__m128i h, uint32_t * DETEX_RESTRICT xp) {
+	const __m128i nan_mask = _mm_cmpgt_epi16(_mm_and_si128(h, _mm_set1_epi16(0x7FFF)), _mm_set1_epi16(0x7C00));
+	if (_mm_movemask_epi8(nan_mask) == 0)
+		return;
+	uint16_t lanes[8];
+	_mm_storeu_si128((__m128i *)lanes, h);
+	for (int i = 0; i < 8; i++)
+		if ((lanes[i] & 0x7FFFu) > 0x7C00u)
+			xp[i] = DETEX_HALF_FLOAT_CANONICAL_NAN;
+}
+
+DETEX_TARGET_F16C static int halfp2singles_f16c(uint32_t * DETEX_RESTRICT xp, const uint16_t * DETEX_RESTRICT hp, int numel) {
+	int i = 0;
+	for (; i + 8 <= numel; i += 8) {
+		const __m128i h = _mm_loadu_si128((const __m128i *)(hp + i));
+		_mm256_storeu_ps((float *)(xp + i), _mm256_cvtph_ps(h));
+		detexFixupHalfNaNs(h, xp + i);
+	}
+	return i;
+}
+
+// Four halves (zero extended to 32 bits) to four floats, following ryg's
+// half_to_float_fast. Denormals go through an exact float subtraction.
+static DETEX_INLINE_ONLY __m128i detexHalf4ToFloat4SSE2(__m128i h) {
+	const __m128i exp_mask = _mm_set1_epi32(0x7C00 << 13);
+	const __m128i o_nosign = _mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(0x7FFF)), 13);
+	const __m128i e = _mm_and_si128(o_nosign, exp_mask);
+	__m128i o = _mm_add_epi32(o_nosign, _mm_set1_epi32((127 - 15) << 23));
+	// Inf/NaN: push the exponent all the way up.
+	const __m128i is_inf_nan = _mm_cmpeq_epi32(e, exp_mask);
+	o = _mm_add_epi32(o, _mm_and_si128(is_inf_nan, _mm_set1_epi32((128 - 16) << 23)));
+	// Zero/denormal: renormalize.
+	const __m128i is_denormal = _mm_cmpeq_epi32(e, _mm_setzero_si128());
+	const __m128i renormalized = _mm_castps_si128(_mm_sub_ps(
+		_mm_castsi128_ps(_mm_add_epi32(o, _mm_set1_epi32(1 << 23))),
+		_mm_castsi128_ps(_mm_set1_epi32(113 << 23))));
+	o = _mm_or_si128(_mm_and_si128(is_denormal, renormalized), _mm_andnot_si128(is_denormal, o));
+	const __m128i sign = _mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(0x8000)), 16);
+	return _mm_or_si128(o, sign);
+}
+
+static int halfp2singles_sse2(uint32_t * DETEX_RESTRICT xp, const uint16_t * DETEX_RESTRICT hp, int numel) {
+	int i = 0;
+	const __m128i zero = _mm_setzero_si128();
+	for (; i + 8 <= numel; i += 8) {
+		const __m128i h = _mm_loadu_si128((const __m128i *)(hp + i));
+		_mm_storeu_si128((__m128i *)(xp + i), detexHalf4ToFloat4SSE2(_mm_unpacklo_epi16(h, zero)));
+		_mm_storeu_si128((__m128i *)(xp + i + 4), detexHalf4ToFloat4SSE2(_mm_unpackhi_epi16(h, zero)));
+		detexFixupHalfNaNs(h, xp + i);
+	}
+	return i;
+}
+
+// Four floats to four halves (in the low 16 bits of each lane). Returns false
+// when a lane would underflow into a half denormal, those need the variable
+// shift of the scalar path.
+static DETEX_INLINE_ONLY bool detexFloat4ToHalf4SSE2(__m128i x, __m128i &out) {
+	const __m128i abs = _mm_and_si128(x, _mm_set1_epi32(0x7FFFFFFF));
+	const __m128i xe = _mm_and_si128(x, _mm_set1_epi32(0x7F800000));
+	const __m128i sign = _mm_and_si128(_mm_srli_epi32(x, 16), _mm_set1_epi32(0x8000));
+
+	// Float zero or denormal underflows to a signed zero.
+	const __m128i is_zero = _mm_cmpeq_epi32(xe, _mm_setzero_si128());
+	// Half exponent in [1, 30].
+	const __m128i is_normal = _mm_and_si128(
+		_mm_cmpgt_epi32(xe, _mm_set1_epi32((113 << 23) - 1)),
+		_mm_cmplt_epi32(xe, _mm_set1_epi32(143 << 23)));
+	const __m128i is_nan = _mm_cmpgt_epi32(abs, _mm_set1_epi32(0x7F800000));
+	// Overflow or infinity.
+	const __m128i is_inf = _mm_andnot_si128(is_nan, _mm_cmpgt_epi32(xe, _mm_set1_epi32((143 << 23) - 1)));
+
+	const __m128i handled = _mm_or_si128(_mm_or_si128(is_zero, is_normal), _mm_or_si128(is_nan, is_inf));
+	if (_mm_movemask_epi8(handled) != 0xFFFF)
+		return false;
+
+	// Rebias the exponent and round on the first dropped mantissa bit, a carry
+	// into the exponent (even up to infinity) is intended.
+	__m128i normal = _mm_sub_epi32(_mm_srli_epi32(abs, 13), _mm_set1_epi32(112 << 10));
+	normal = _mm_add_epi32(normal, _mm_and_si128(_mm_srli_epi32(abs, 12), _mm_set1_epi32(1)));
+	normal = _mm_or_si128(normal, sign);
+
+	__m128i result = _mm_and_si128(is_zero, sign);
+	result = _mm_or_si128(result, _mm_and_si128(is_normal, normal));
+	result = _mm_or_si128(result, _mm_and_si128(is_inf, _mm_or_si128(sign, _mm_set1_epi32(0x7C00))));
+	result = _mm_or_si128(result, _mm_and_si128(is_nan, _mm_set1_epi32(0xFE00)));
+	out = result;
+	return true;
+}
+
+static int singles2halfp_sse2(uint16_t * DETEX_RESTRICT hp, const uint32_t * DETEX_RESTRICT xp, int numel) {
+	int i = 0;
+	for (; i + 8 <= numel; i += 8) {
+		__m128i lo, hi;
+		if (detexFloat4ToHalf4SSE2(_mm_loadu_si128((const __m128i *)(xp + i)), lo) &&
+		detexFloat4ToHalf4SSE2(_mm_loadu_si128((const __m128i *)(xp + i + 4)), hi)) {
+			// Sign extend so the signed saturating pack keeps all 16 bits.
+			lo = _mm_srai_epi32(_mm_slli_epi32(lo, 16), 16);
+			hi = _mm_srai_epi32(_mm_slli_epi32(hi, 16), 16);
+			_mm_storeu_si128((__m128i *)(hp + i), _mm_packs_epi32(lo, hi));
+		}
+		else
+			singles2halfp(hp + i, (void *)(xp + i), 8);
+	}
+	return i;
+}
+
+#endif
+
 // Conversion functions.
 void detexConvertHalfFloatToFloat(uint16_t *source_buffer, int n, float *target_buffer) {
-    halfp2singles(target_buffer, source_buffer, n);
+#if DETEX_HALF_FLOAT_SIMD
+	const int done = detexHasF16C() ?
+		halfp2singles_f16c((uint32_t *)target_buffer, source_buffer, n) :
+		halfp2singles_sse2((uint32_t *)target_buffer, source_buffer, n);
+	halfp2singles(target_buffer + done, source_buffer + done, n - done);
+#else
+	halfp2singles(target_buffer, source_buffer, n);
+#endif
 }
 
-#if 0
 void detexConvertFloatToHalfFloat(float *source_buffer, int n, uint16_t *target_buffer) {
+#if DETEX_HALF_FLOAT_SIMD
+	const int done = singles2halfp_sse2(target_buffer, (const uint32_t *)source_buffer, n);
+	singles2halfp(target_buffer + done, source_buffer + done, n - done);
+#else
 	singles2halfp(target_buffer, source_buffer, n);
+#endif
 }
 
+#if 0
 // Convert normalized half floats to unsigned 16-bit integers in place.
 void detexConvertNormalizedHalfFloatToUInt16(uint16_t *buffer, int n) {
 	fesetround(FE_DOWNWARD);
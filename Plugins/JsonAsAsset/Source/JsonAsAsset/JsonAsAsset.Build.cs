@@ -53,7 +53,6 @@ public class JsonAsAsset : ModuleRules
 			"AudioModulation",
 			"RHI",
 			"Detex",
-			"NVTT",
 			"RenderCore",
 
 #if UE_5_0_OR_LATER
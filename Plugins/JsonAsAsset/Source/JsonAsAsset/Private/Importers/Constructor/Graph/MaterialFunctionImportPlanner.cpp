@@ -0,0 +1,176 @@
+// Copyright JAA Contributors 2024-2025
+
+#include "Importers/Constructor/Graph/MaterialFunctionImportPlanner.h"
+
+#include "Importers/Constructor/Importer.h"
+#include "Utilities/AssetUtilities.h"
+#include "Utilities/JsonStreamUtilities.h"
+#include "Settings/JsonAsAssetSettings.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+
+void FMaterialFunctionImportPlanner::ImportFunctionsFirst(TArray<FString>& Files, TMap<FString, TArray<TSharedPtr<FJsonValue>>>& OutParsedFiles) {
+	TMap<FString, FPlannedFunction> Functions;
+	TMap<FString, FString> SelectedFunctions;
+
+	// Game path of the function, and the file that referenced it
+	TArray<TPair<FString, FString>> Pending;
+
+	for (const FString& File : Files) {
+		FString Type;
+		TArray<TSharedPtr<FJsonValue>> Exports;
+		if (!ReadExports(File, Type, Exports)) continue;
+
+		const TArray<FString> References = CollectFunctionReferences(Exports);
+
+		for (const FString& Reference : References) {
+			Pending.Add(TPair<FString, FString>(Reference, File));
+		}
+
+		if (Type != "MaterialFunction") {
+			/* Selected materials are imported from what was parsed here, not read again */
+			OutParsedFiles.Add(File, MoveTemp(Exports));
+			continue;
+		}
+
+		/* Selected functions are part of the plan too, so they are not imported twice */
+		const FString Name = Exports[0]->AsObject()->GetStringField(TEXT("Name"));
+		const FString GamePath = FAssetUtilities::GetAssetPackageName(Name, FPaths::ConvertRelativePathToFull(File));
+
+		FPlannedFunction& Function = Functions.Add(GamePath);
+		Function.File = File;
+		Function.Exports = MoveTemp(Exports);
+		Function.Dependencies = References;
+
+		SelectedFunctions.Add(GamePath, File);
+	}
+
+	/* Local Fetch downloads missing functions when the graph loads them, the graph only falls back to their files after that */
+	const bool bEnableLocalFetch = GetDefault<UJsonAsAssetSettings>()->bEnableLocalFetch;
+
+	// Walk every reference once, functions already in the project are left alone
+	while (Pending.Num() > 0) {
+		const TPair<FString, FString> Reference = Pending.Pop();
+		const FString& GamePath = Reference.Key;
+
+		if (bEnableLocalFetch || Functions.Contains(GamePath) || FindPackage(nullptr, *GamePath) != nullptr || FPackageName::DoesPackageExist(GamePath)) {
+			continue;
+		}
+
+		const FString File = IImporter::GetAssetReferenceFile(GamePath, FPaths::ConvertRelativePathToFull(Reference.Value));
+
+		FString Type;
+		TArray<TSharedPtr<FJsonValue>> Exports;
+		if (!ReadExports(File, Type, Exports) || Type != "MaterialFunction") {
+			continue;
+		}
+
+		FPlannedFunction& Function = Functions.Add(GamePath);
+		Function.File = File;
+		Function.Dependencies = CollectFunctionReferences(Exports);
+		Function.Exports = MoveTemp(Exports);
+
+		for (const FString& Dependency : Function.Dependencies) {
+			Pending.Add(TPair<FString, FString>(Dependency, File));
+		}
+	}
+
+	if (Functions.Num() == 0) {
+		return;
+	}
+
+	// Leaves first
+	TArray<FString> Order;
+	TSet<FString> Visiting;
+	TSet<FString> Visited;
+
+	TArray<FString> GamePaths;
+	Functions.GetKeys(GamePaths);
+
+	for (const FString& GamePath : GamePaths) {
+		VisitFunction(GamePath, Functions, Visiting, Visited, Order);
+	}
+
+	UE_LOG(LogJson, Log, TEXT("Importing %d material functions ahead of their materials"), Order.Num());
+
+	for (const FString& GamePath : Order) {
+		FPlannedFunction& Function = Functions[GamePath];
+
+		// Imported from the exports parsed while planning, released right after
+		IImporter Importer;
+		Importer.ImportExports(MoveTemp(Function.Exports), Function.File);
+
+		if (const FString* SelectedFile = SelectedFunctions.Find(GamePath)) {
+			Files.Remove(*SelectedFile);
+		}
+	}
+}
+
+bool FMaterialFunctionImportPlanner::ReadExports(const FString& File, FString& OutType, TArray<TSharedPtr<FJsonValue>>& OutExports) {
+	/* Only materials and functions call functions, anything else is classified from the head of the file */
+	FString Name;
+	if (!FJsonStreamUtilities::ReadFirstExportHeader(File, OutType, Name) || (OutType != "Material" && OutType != "MaterialFunction")) {
+		return false;
+	}
+
+	FString Content;
+	if (!FFileHelper::LoadFileToString(Content, *File)) {
+		return false;
+	}
+
+	const TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(Content);
+
+	return FJsonSerializer::Deserialize(JsonReader, OutExports) && OutExports.Num() > 0 && OutExports[0]->AsObject().IsValid();
+}
+
+TArray<FString> FMaterialFunctionImportPlanner::CollectFunctionReferences(const TArray<TSharedPtr<FJsonValue>>& Exports) {
+	TArray<FString> References;
+
+	for (const TSharedPtr<FJsonValue>& Value : Exports) {
+		const TSharedPtr<FJsonObject> Export = Value->AsObject();
+		if (!Export.IsValid() || Export->GetStringField(TEXT("Type")) != "MaterialExpressionMaterialFunctionCall") continue;
+
+		const TSharedPtr<FJsonObject>* Properties;
+		const TSharedPtr<FJsonObject>* MaterialFunction;
+
+		if (!Export->TryGetObjectField(TEXT("Properties"), Properties) || !Properties->Get()->TryGetObjectField(TEXT("MaterialFunction"), MaterialFunction)) {
+			continue;
+		}
+
+		// Layers and blends are handled by their own importers
+		if (!MaterialFunction->Get()->GetStringField(TEXT("ObjectName")).StartsWith("MaterialFunction'")) {
+			continue;
+		}
+
+		FString GamePath;
+		MaterialFunction->Get()->GetStringField(TEXT("ObjectPath")).Split(".", &GamePath, nullptr);
+
+		if (!GamePath.IsEmpty()) {
+			References.AddUnique(GamePath);
+		}
+	}
+
+	return References;
+}
+
+void FMaterialFunctionImportPlanner::VisitFunction(const FString& GamePath, TMap<FString, FPlannedFunction>& Functions, TSet<FString>& Visiting, TSet<FString>& Visited, TArray<FString>& OutOrder) {
+	/* A cycle can't be compiled by the engine either, it is broken where it closes */
+	if (Visited.Contains(GamePath) || Visiting.Contains(GamePath)) {
+		return;
+	}
+
+	const FPlannedFunction* Function = Functions.Find(GamePath);
+	if (Function == nullptr) {
+		return;
+	}
+
+	Visiting.Add(GamePath);
+
+	for (const FString& Dependency : Function->Dependencies) {
+		VisitFunction(Dependency, Functions, Visiting, Visited, OutOrder);
+	}
+
+	Visiting.Remove(GamePath);
+	Visited.Add(GamePath);
+	OutOrder.Add(GamePath);
+}
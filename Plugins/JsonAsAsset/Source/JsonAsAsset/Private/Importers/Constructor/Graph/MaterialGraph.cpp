@@ -3,6 +3,7 @@
 #include "Importers/Constructor/Graph/MaterialGraph.h"
 #include "Utilities/MathUtilities.h"
 #include "Styling/SlateIconFinder.h"
+#include "Async/ParallelFor.h"
 
 // Expressions
 #include "Materials/MaterialExpressionComment.h"
@@ -61,26 +62,16 @@ TSharedPtr<FJsonObject> IMaterialGraph::FindEditorOnlyData(const FString& Type,
 
 TMap<FName, UMaterialExpression*> IMaterialGraph::ConstructExpressions(UObject* Parent, const FString& Outer, TArray<FName>& ExpressionNames, TMap<FName, FExportData>& Exports) {
 	TMap<FName, UMaterialExpression*> CreatedExpressionMap;
+	CreatedExpressionMap.Reserve(ExpressionNames.Num());
 
-	for (FName Name : ExpressionNames) {
-		FName Type;
-		FJsonObject* SharedRef = nullptr;
-		bool bFound = false;
-
-		for (TTuple<FName, FExportData>& Key : Exports) {
-			TSharedPtr<FJsonObject>* SharedO = new TSharedPtr<FJsonObject>(Key.Value.Json);
+	const FName OuterName = FName(*Outer);
 
-			if (Key.Key == Name && Key.Value.Outer == FName(*Outer)) {
-				Type = Key.Value.Type;
-				SharedRef = SharedO->Get();
-
-				bFound = true;
-				break;
-			}
-		}
+	// Exports are already keyed by name, one lookup per expression
+	for (const FName Name : ExpressionNames) {
+		const FExportData* Export = Exports.Find(Name);
 
-		if (!bFound) continue;
-		UMaterialExpression* Ex = CreateEmptyExpression(Parent, Name, Type, SharedRef);
+		if (Export == nullptr || Export->Outer != OuterName) continue;
+		UMaterialExpression* Ex = CreateEmptyExpression(Parent, Name, Export->Type, Export->Json);
 		if (Ex == nullptr)
 			continue;
 
@@ -116,13 +107,22 @@ FMaterialAttributesInput IMaterialGraph::CreateMaterialAttributesInput(const TSh
 }
 
 void IMaterialGraph::PropagateExpressions(UObject* Parent, TArray<FName>& ExpressionNames, TMap<FName, FExportData>& Exports, TMap<FName, UMaterialExpression*>& CreatedExpressionMap, bool bCheckOuter, bool bSubgraph) {
+	struct FPendingExpression {
+		FExportData* Type;
+		UMaterialExpression* Expression;
+		TSharedPtr<FJsonObject> Properties;
+		TArray<FPropertyWrite> Writes;
+	};
+
+	TArray<FPendingExpression> PendingExpressions;
+	PendingExpressions.Reserve(ExpressionNames.Num());
+
 	for (FName Name : ExpressionNames) {
 		FExportData* Type = Exports.Find(Name);
-		TSharedPtr<FJsonObject> Properties = Type->Json->GetObjectField(TEXT("Properties"));
 
 		// Find the expression from FName
-		if (!CreatedExpressionMap.Contains(Name)) continue;
-		UMaterialExpression* Expression = *CreatedExpressionMap.Find(Name);
+		UMaterialExpression** Expression = CreatedExpressionMap.Find(Name);
+		if (Expression == nullptr) continue;
 
 		//	Used for Subgraphs:
 		//  | Checks if the outer is the same as the parent
@@ -133,6 +133,29 @@ void IMaterialGraph::PropagateExpressions(UObject* Parent, TArray<FName>& Expres
 				continue;
 		}
 
+		FPendingExpression& Pending = PendingExpressions.AddDefaulted_GetRef();
+		Pending.Type = Type;
+		Pending.Expression = *Expression;
+		Pending.Properties = Type->Json->GetObjectField(TEXT("Properties"));
+	}
+
+	// Json traversal and value conversion of every node runs on workers first,
+	// the game thread then only writes the decoded values into the expressions
+	const bool bSingleThreaded = !CanReadJsonOffGameThread();
+
+	UObjectSerializer* ObjectSerializer = GetObjectSerializer();
+
+	ParallelFor(PendingExpressions.Num(), [&PendingExpressions, ObjectSerializer](const int32 Index) {
+		FPendingExpression& Pending = PendingExpressions[Index];
+
+		ObjectSerializer->DecodeObjectProperties(Pending.Properties, Pending.Expression, Pending.Writes);
+	}, bSingleThreaded);
+
+	for (FPendingExpression& Pending : PendingExpressions) {
+		FExportData* Type = Pending.Type;
+		UMaterialExpression* Expression = Pending.Expression;
+		TSharedPtr<FJsonObject> Properties = Pending.Properties;
+
 		// ------------ Manually check for Material Function Calls ------------ 
 		if (Type->Type == "MaterialExpressionMaterialFunctionCall") {
 			UMaterialExpressionMaterialFunctionCall* MaterialFunctionCall = Cast<UMaterialExpressionMaterialFunctionCall>(Expression);
@@ -167,7 +190,7 @@ void IMaterialGraph::PropagateExpressions(UObject* Parent, TArray<FName>& Expres
 		}
 
 		// Sets 99% of properties for nodes
-		GetObjectSerializer()->DeserializeObjectProperties(Properties, Expression);
+		ObjectSerializer->ApplyObjectProperties(Pending.Writes, Properties, Expression);
 
 		// Material Nodes with edited properties (ex: 9 objects with the same name ---> array of objects)
 		if (Type->Type == "MaterialExpressionQualitySwitch") {
@@ -10,29 +10,38 @@
 #include "Sound/SoundCue.h"
 #include "Settings/JsonAsAssetSettings.h"
 
-void ISoundGraph::ConstructNodes(USoundCue* SoundCue, TArray<TSharedPtr<FJsonValue>> JsonArray, TMap<FString, USoundNode*>& OutNodes) {
-	for (TSharedPtr<FJsonValue> JsonValue : JsonArray) {
-		TSharedPtr<FJsonObject> CurrentNodeObject = JsonValue->AsObject();
+void ISoundGraph::ConstructNodes(USoundCue* SoundCue, const TArray<TSharedPtr<FJsonValue>>& JsonArray, TMap<FString, USoundNode*>& OutNodes) {
+	// Node classes are found once per type
+	TMap<FString, UClass*> NodeClasses;
 
-		if (!CurrentNodeObject->HasField(TEXT("Type"))) {
+	OutNodes.Reserve(JsonArray.Num());
+
+	for (const TSharedPtr<FJsonValue>& JsonValue : JsonArray) {
+		const TSharedPtr<FJsonObject> CurrentNodeObject = JsonValue->AsObject();
+
+		FString NodeType;
+		if (!CurrentNodeObject->TryGetStringField(TEXT("Type"), NodeType)) {
 			continue;
 		}
-		
-		FString NodeType = CurrentNodeObject->GetStringField(TEXT("Type"));
-		FString NodeName = CurrentNodeObject->GetStringField(TEXT("Name"));
 
 		// Filter only exports with SoundNode at the start
 		if (NodeType.StartsWith("SoundNode")) {
-			USoundNode* SoundCueNode = CreateEmptyNode(FName(*NodeName), FName(*NodeType), SoundCue);
+			UClass** Class = NodeClasses.Find(NodeType);
+
+			if (Class == nullptr) {
+				Class = &NodeClasses.Add(NodeType, FindObject<UClass>(ANY_PACKAGE, *NodeType));
+			}
 
-			OutNodes.Add(NodeName, SoundCueNode);
+			OutNodes.Add(CurrentNodeObject->GetStringField(TEXT("Name")), CreateEmptyNode(*Class, SoundCue));
 		}
 	}
 }
 
 USoundNode* ISoundGraph::CreateEmptyNode(FName Name, FName Type, USoundCue* SoundCue) {
-	UClass* Class = FindObject<UClass>(ANY_PACKAGE, *Type.ToString());
+	return CreateEmptyNode(FindObject<UClass>(ANY_PACKAGE, *Type.ToString()), SoundCue);
+}
 
+USoundNode* ISoundGraph::CreateEmptyNode(UClass* Class, USoundCue* SoundCue) {
 	// TODO: Construct the sound node manually to have the exact same object name
 	return SoundCue->ConstructSoundNode<USoundNode>(
 		Class,
@@ -40,81 +49,70 @@ USoundNode* ISoundGraph::CreateEmptyNode(FName Name, FName Type, USoundCue* Soun
 	);
 }
 
-void ISoundGraph::SetupNodes(USoundCue* SoundCueAsset, TMap<FString, USoundNode*> SoundCueNodes, TArray<TSharedPtr<FJsonValue>> JsonObjectArray) {
-	auto MainJsonObject = JsonObjectArray[0]->AsObject();
-	auto MainJsonObjectProperties = MainJsonObject->TryGetField(TEXT("Properties"))->AsObject();
+FString ISoundGraph::GetNodeName(const FString& ObjectName) {
+	const int32 ColonIndex = ObjectName.Find(TEXT(":"));
+	const int32 QuoteIndex = ObjectName.Find(TEXT("'"), ESearchCase::CaseSensitive, ESearchDir::FromEnd);
 
-	// If Node is connected to Root Node
-	if (MainJsonObjectProperties->HasField(TEXT("FirstNode"))) {
-		auto FirstNodeProp = MainJsonObjectProperties->TryGetField(TEXT("FirstNode"))->AsObject();
-		auto FirstNodeName = FirstNodeProp->TryGetField(TEXT("ObjectName"))->AsString();
+	return ObjectName.Mid(ColonIndex + 1, QuoteIndex - ColonIndex - 1);
+}
 
-		int32 ColonIndex = FirstNodeName.Find(TEXT(":"));
-		int32 QuoteIndex = FirstNodeName.Find(TEXT("'"), ESearchCase::CaseSensitive, ESearchDir::FromEnd);
-		FString ChildNodeName = FirstNodeName.Mid(ColonIndex + 1, QuoteIndex - ColonIndex - 1);
+void ISoundGraph::SetupNodes(USoundCue* SoundCueAsset, const TMap<FString, USoundNode*>& SoundCueNodes, const TArray<TSharedPtr<FJsonValue>>& JsonObjectArray) {
+	const TSharedPtr<FJsonObject> MainJsonObjectProperties = JsonObjectArray[0]->AsObject()->GetObjectField(TEXT("Properties"));
 
-		USoundNode** FirstNode = SoundCueNodes.Find(ChildNodeName);
-		UEdGraphNode* RootNode = SoundCueAsset->SoundCueGraph->Nodes[0];
+	// If Node is connected to Root Node
+	const TSharedPtr<FJsonObject>* FirstNodeProp;
 
-		// Connect Node to Root Node
-		if (FirstNode && RootNode) {
-			ConnectEdGraphNode((*FirstNode)->GetGraphNode(), RootNode, 0);
+	if (MainJsonObjectProperties->TryGetObjectField(TEXT("FirstNode"), FirstNodeProp)) {
+		if (USoundNode* const* FirstNode = SoundCueNodes.Find(GetNodeName((*FirstNodeProp)->GetStringField(TEXT("ObjectName"))))) {
+			SoundCueAsset->FirstNode = *FirstNode;
 		}
 	}
 
-	// Connections done here
-	for (TSharedPtr<FJsonValue> JsonValue : JsonObjectArray) {
-		TSharedPtr<FJsonObject> CurrentNodeObject = JsonValue->AsObject();
+	// Child nodes are set on the sound nodes only, the graph is linked from them once at the end
+	for (const TSharedPtr<FJsonValue>& JsonValue : JsonObjectArray) {
+		const TSharedPtr<FJsonObject> CurrentNodeObject = JsonValue->AsObject();
 
-		if (!CurrentNodeObject->HasField(TEXT("Type"))) {
+		FString NodeType;
+		if (!CurrentNodeObject->TryGetStringField(TEXT("Type"), NodeType)) {
 			continue;
 		}
-		
-		FString NodeType = CurrentNodeObject->GetStringField(TEXT("Type"));
-		FString NodeName = CurrentNodeObject->GetStringField(TEXT("Name"));
 
 		// Make sure it has Properties and it's a SoundNode
-		if (!CurrentNodeObject->HasField(TEXT("Properties")) || !NodeType.StartsWith("SoundNode")) {
+		const TSharedPtr<FJsonObject>* NodePropertiesPtr;
+
+		if (!NodeType.StartsWith("SoundNode") || !CurrentNodeObject->TryGetObjectField(TEXT("Properties"), NodePropertiesPtr)) {
 			continue;
 		}
 
-		TSharedPtr<FJsonObject> NodeProperties = CurrentNodeObject->TryGetField(TEXT("Properties"))->AsObject();
+		const TSharedPtr<FJsonObject> NodeProperties = *NodePropertiesPtr;
+
+		USoundNode* const* CurrentNode = SoundCueNodes.Find(CurrentNodeObject->GetStringField(TEXT("Name")));
+		if (CurrentNode == nullptr || *CurrentNode == nullptr) {
+			continue;
+		}
 
-		USoundNode** CurrentNode = SoundCueNodes.Find(NodeName);
 		USoundNode* Node = *CurrentNode;
 		
 		// Filter only node with ChildNodes and handle the pins
-		if (NodeProperties->HasField(TEXT("ChildNodes"))) {
-			TArray<TSharedPtr<FJsonValue>> CurrentNodeChildNodes = NodeProperties->TryGetField(TEXT("ChildNodes"))->AsArray();
-
-			// Save an index of the current connection
-			int32 ConnectionIndex = 0;
+		const TArray<TSharedPtr<FJsonValue>>* CurrentNodeChildNodes;
 
-			for (TSharedPtr<FJsonValue> CurrentNodeValue : CurrentNodeChildNodes) {
-				auto CurrentNodeChildNode = CurrentNodeValue->AsObject();
-
-				// Insert a child node if it doesn't exist
+		if (NodeProperties->TryGetArrayField(TEXT("ChildNodes"), CurrentNodeChildNodes)) {
+			for (int32 ConnectionIndex = 0; ConnectionIndex < CurrentNodeChildNodes->Num(); ConnectionIndex++) {
+				// Insert a child node if it doesn't exist, this also adds its pin
 				if (!Node->ChildNodes.IsValidIndex(ConnectionIndex)) {
 					Node->InsertChildNode(ConnectionIndex);
 				}
 
-				if (CurrentNodeChildNode->HasField(TEXT("ObjectName"))) {
-					auto CurrentChildNodeObjectName = CurrentNodeChildNode->TryGetField(TEXT("ObjectName"))->AsString();
-
-					int32 ColonIndex = CurrentChildNodeObjectName.Find(TEXT(":"));
-					int32 QuoteIndex = CurrentChildNodeObjectName.Find(TEXT("'"), ESearchCase::CaseSensitive, ESearchDir::FromEnd);
-					FString CurrentChildNodeName = CurrentChildNodeObjectName.Mid(ColonIndex + 1, QuoteIndex - ColonIndex - 1);
+				const TSharedPtr<FJsonObject> CurrentNodeChildNode = (*CurrentNodeChildNodes)[ConnectionIndex]->AsObject();
 
-					USoundNode** CurrentChildNode = SoundCueNodes.Find(CurrentChildNodeName);
-					int CurrentPin = ConnectionIndex + 1;
+				FString CurrentChildNodeObjectName;
+				if (!Node->ChildNodes.IsValidIndex(ConnectionIndex) || !CurrentNodeChildNode.IsValid() || !CurrentNodeChildNode->TryGetStringField(TEXT("ObjectName"), CurrentChildNodeObjectName)) {
+					continue;
+				}
 
-					// Connect it
-					if (CurrentNode && CurrentChildNode) {
-						ConnectSoundNode(*CurrentChildNode, *CurrentNode, CurrentPin);
-					}
+				if (USoundNode* const* CurrentChildNode = SoundCueNodes.Find(GetNodeName(CurrentChildNodeObjectName))) {
+					Node->ChildNodes[ConnectionIndex] = *CurrentChildNode;
 				}
-				
-				ConnectionIndex++;
 			}
 		}
 
@@ -122,7 +120,7 @@ void ISoundGraph::SetupNodes(USoundCue* SoundCueAsset, TMap<FString, USoundNode*
 		GetObjectSerializer()->DeserializeObjectProperties(RemovePropertiesShared(NodeProperties, TArray<FString>
 		{
 			"ChildNodes"
-		}), *CurrentNode);
+		}), Node);
 
 		// Import Sound Wave
 		if (Cast<USoundNodeWavePlayer>(Node) != nullptr) {
@@ -11,8 +11,11 @@
 
 // Utilities
 #include "Utilities/AssetUtilities.h"
+#include "Utilities/MaterialCompileBatch.h"
+#include "Utilities/AnimationCompressionBatch.h"
 
 #include "Misc/MessageDialog.h"
+#include "HAL/FileManager.h"
 #include "UObject/SavePackage.h"
 
 // Slate Icons
@@ -149,8 +152,10 @@ TArray<FString> ImporterAcceptedTypes = {
 
 // Handles the JSON of a file.
 // I want to replace Handle with Import in most of these functions
-bool IImporter::ImportExports(TArray<TSharedPtr<FJsonValue>> Exports, FString File, const bool bHideNotifications) const
+bool IImporter::ImportExports(TArray<TSharedPtr<FJsonValue>> Exports, FString File, const bool bHideNotifications, const TSharedPtr<FDataTableRowStream>& RowStream) const
 {
+	FGameplayTagCacheScope GameplayTagCacheScope;
+
 	TArray<FString> Types;
 	for (const TSharedPtr<FJsonValue>& Obj : Exports) Types.Add(Obj->AsObject()->GetStringField(TEXT("Type")));
 
@@ -217,7 +222,7 @@ bool IImporter::ImportExports(TArray<TSharedPtr<FJsonValue>> Exports, FString Fi
 				else if (Type == "NiagaraParameterCollection") 
 				    Importer = new INiagaraParameterCollectionImporter(Name, File, DataObject, LocalPackage, LocalOutermostPkg);
  				else if (Type == "DataTable") 
-				    Importer = new IDataTableImporter(Name, File, DataObject, LocalPackage, LocalOutermostPkg);
+				    Importer = new IDataTableImporter(Name, File, DataObject, LocalPackage, LocalOutermostPkg, RowStream);
 
  				else if (Type == "UserDefinedEnum") 
  					Importer = new IUserDefinedEnumImporter(Name, File, DataObject, LocalPackage, LocalOutermostPkg);
@@ -313,7 +318,12 @@ bool IImporter::HandleAssetCreation(UObject* Asset) const {
 	if (!Asset->MarkPackageDirty()) return false;
 	
 	Package->SetDirtyFlag(true);
-	Asset->PostEditChange();
+
+	// Materials inside an import batch are compiled once at the end of it
+	if (!FMaterialCompileBatch::Defer(Asset)) {
+		Asset->PostEditChange();
+	}
+
 	Asset->AddToRoot();
 	
 	Package->FullyLoad();
@@ -397,16 +407,7 @@ template <typename T>
 void IImporter::LoadObject(const TSharedPtr<FJsonObject>* PackageIndex, TObjectPtr<T>& Object) {
 	FString ObjectType, ObjectName, ObjectPath, Outer;
 	PackageIndex->Get()->GetStringField(TEXT("ObjectName")).Split("'", &ObjectType, &ObjectName);
-	PackageIndex->Get()->GetStringField(TEXT("ObjectPath")).Split(".", &ObjectPath, nullptr);
-
-	const UJsonAsAssetSettings* Settings = GetDefault<UJsonAsAssetSettings>();
-
-	// Rare case of needing a GameName
-	if (!Settings->AssetSettings.GameName.IsEmpty()) {
-		ObjectPath = ObjectPath.Replace(*(Settings->AssetSettings.GameName + "/Content"), TEXT("/Game"));
-	}
-
-	ObjectPath = ObjectPath.Replace(TEXT("Engine/Content"), TEXT("/Engine"));
+	ObjectPath = GetPackagePath(PackageIndex->Get()->GetStringField(TEXT("ObjectPath")));
 	ObjectName = ObjectName.Replace(TEXT("'"), TEXT(""));
 
 	if (ObjectName.Contains(".")) {
@@ -454,6 +455,10 @@ template TArray<TObjectPtr<UCurveLinearColor>> IImporter::LoadObject<UCurveLinea
 
 template <typename T>
 TArray<TObjectPtr<T>> IImporter::LoadObject(const TArray<TSharedPtr<FJsonValue>>& PackageArray, TArray<TObjectPtr<T>> Array) {
+	// Each path is resolved once, the same object is often listed more than once
+	TMap<FString, TObjectPtr<T>> Resolved;
+	Array.Reserve(Array.Num() + PackageArray.Num());
+
 	for (const TSharedPtr<FJsonValue>& ArrayElement : PackageArray) {
 		const TSharedPtr<FJsonObject> ObjectPtr = ArrayElement->AsObject();
 
@@ -462,24 +467,43 @@ TArray<TObjectPtr<T>> IImporter::LoadObject(const TArray<TSharedPtr<FJsonValue>>
 		ObjectPtr->GetStringField(TEXT("ObjectPath")).Split(".", &ObjectPath, nullptr);
 		ObjectName = ObjectName.Replace(TEXT("'"), TEXT(""));
 
-		TObjectPtr<T> LoadedObject = Cast<T>(StaticLoadObject(T::StaticClass(), nullptr, *(ObjectPath + "." + ObjectName)));
-		Array.Add(DownloadWrapper(LoadedObject, ObjectType, ObjectName, ObjectPath));
+		const FString FullPath = ObjectPath + "." + ObjectName;
+
+		if (const TObjectPtr<T>* Found = Resolved.Find(FullPath)) {
+			Array.Add(*Found);
+			continue;
+		}
+
+		TObjectPtr<T> LoadedObject = Cast<T>(StaticLoadObject(T::StaticClass(), nullptr, *FullPath));
+		LoadedObject = DownloadWrapper(LoadedObject, ObjectType, ObjectName, ObjectPath);
+
+		Resolved.Add(FullPath, LoadedObject);
+		Array.Add(LoadedObject);
 	}
 
 	return Array;
 }
 
-// Handles the import of an asset
-bool IImporter::ImportAssetReference(const FString& GamePath) const
-{
+FString IImporter::GetPackagePath(const FString& ObjectPath) {
+	FString PackagePath;
+	if (!ObjectPath.Split(".", &PackagePath, nullptr)) {
+		PackagePath = ObjectPath;
+	}
+
 	const UJsonAsAssetSettings* Settings = GetDefault<UJsonAsAssetSettings>();
 
-	FString UnSanitizedCodeName;
-	FilePath.Split(Settings->ExportDirectory.Path + "/", nullptr, &UnSanitizedCodeName);
-	UnSanitizedCodeName.Split("/", &UnSanitizedCodeName, nullptr, ESearchCase::IgnoreCase, ESearchDir::FromStart);
+	// Rare case of needing a GameName
+	if (!Settings->AssetSettings.GameName.IsEmpty()) {
+		PackagePath = PackagePath.Replace(*(Settings->AssetSettings.GameName + "/Content"), TEXT("/Game"));
+	}
 
-	FString UnSanitizedPath = GamePath.Replace(TEXT("/Game/"), *(UnSanitizedCodeName + "/Content/"));
-	UnSanitizedPath = FPaths::Combine(Settings->ExportDirectory.Path, UnSanitizedPath + ".json");
+	return PackagePath.Replace(TEXT("Engine/Content"), TEXT("/Engine"));
+}
+
+// Handles the import of an asset
+bool IImporter::ImportAssetReference(const FString& GamePath) const
+{
+	const FString UnSanitizedPath = GetAssetReferenceFile(GamePath, FilePath);
 
 	FString ContentBefore;
 	if (FFileHelper::LoadFileToString(ContentBefore, *UnSanitizedPath)) {
@@ -490,9 +514,34 @@ bool IImporter::ImportAssetReference(const FString& GamePath) const
 	return false;
 }
 
+// Finds the exported JSON of a game path, next to the file referencing it
+FString IImporter::GetAssetReferenceFile(const FString& GamePath, const FString& ReferencingFile)
+{
+	const UJsonAsAssetSettings* Settings = GetDefault<UJsonAsAssetSettings>();
+
+	FString UnSanitizedCodeName;
+	ReferencingFile.Split(Settings->ExportDirectory.Path + "/", nullptr, &UnSanitizedCodeName);
+	UnSanitizedCodeName.Split("/", &UnSanitizedCodeName, nullptr, ESearchCase::IgnoreCase, ESearchDir::FromStart);
+
+	const FString UnSanitizedPath = GamePath.Replace(TEXT("/Game/"), *(UnSanitizedCodeName + "/Content/"));
+
+	return FPaths::Combine(Settings->ExportDirectory.Path, UnSanitizedPath + ".json");
+}
+
 // Sends off to the ImportExports function once read
 void IImporter::ImportReference(const FString& File) const
 {
+	FGameplayTagCacheScope GameplayTagCacheScope;
+
+	// Large data tables are imported row by row, straight from the file instead of loading all of it first
+	const FJDataTableImportSettings& DataTableSettings = GetDefault<UJsonAsAssetSettings>()->AssetSettings.DataTableImportSettings;
+
+	if (DataTableSettings.bStreamLargeTables && IFileManager::Get().FileSize(*File) >= static_cast<int64>(DataTableSettings.StreamingThresholdMB) * 1024 * 1024) {
+		if (IDataTableImporter::ImportStreamed(File)) {
+			return;
+		}
+	}
+
 	/* ----  Parse JSON into UE JSON Reader ---- */
 	FString ContentBefore;
 	FFileHelper::LoadFileToString(ContentBefore, *File);
@@ -546,8 +595,8 @@ void IImporter::SavePackage() const
 	const FString PackageName = Package->GetName();
 	const FString PackageFileName = FPackageName::LongPackageNameToFilename(PackageName, FPackageName::GetAssetPackageExtension());
 
-	// User option to save packages on import
-	if (Settings->AssetSettings.bSavePackagesOnImport) {
+	// User option to save packages on import, batched material and animation assets are saved once the batch is done with them
+	if (Settings->AssetSettings.bSavePackagesOnImport && !FMaterialCompileBatch::DeferSave(Package) && !FAnimationCompressionBatch::DeferSave(Package)) {
 #if ENGINE_MAJOR_VERSION >= 5
 		FSavePackageArgs SaveArgs; {
 			SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
@@ -4,7 +4,10 @@
 
 #include "Dom/JsonObject.h"
 #include "Utilities/MathUtilities.h"
+#include "Utilities/CurveKeyReduction.h"
+#include "Utilities/AnimationCompressionBatch.h"
 #include "Animation/AnimSequence.h"
+#include "Async/ParallelFor.h"
 
 #if ENGINE_MAJOR_VERSION == 5
 #include "Animation/AnimData/IAnimationDataController.h"
@@ -25,18 +28,9 @@ bool IAnimationBaseImporter::Import() {
 	UAnimSequenceBase* AnimSequenceBase = nullptr;
 
 	// ----------------------------------------------------------------------------
-	// Find the asset in the current content browser selection
-	TArray<FAssetData> AssetDataList = GetAssetsInSelectedFolder();
-
-	for (const FAssetData& AssetData : AssetDataList) {
-		if (UAnimSequenceBase* SequenceBase = Cast<UAnimSequenceBase>(AssetData.GetAsset())) {
-			FString AnimationName = SequenceBase->GetName();
-
-			if (AnimationName == AssetName) {
-				AnimSequenceBase = SequenceBase;
-			}
-		}
-	}
+	// Find the asset in the current content browser selection, by class and
+	// name from the asset registry so the rest of the folder isn't loaded
+	AnimSequenceBase = FindAssetInSelectedFolder<UAnimSequenceBase>(AssetName);
 
 	if (!AnimSequenceBase) {
 		AnimSequenceBase = GetSelectedAsset<UAnimSequenceBase>();
@@ -72,8 +66,43 @@ bool IAnimationBaseImporter::Import() {
 	if (Properties->TryGetObjectField(TEXT("RawCurveData"), RawCurveData)) FloatCurves = Properties->GetObjectField(TEXT("RawCurveData"))->GetArrayField(TEXT("FloatCurves"));
 	else if (JsonObject->TryGetObjectField(TEXT("CompressedCurveData"), RawCurveData)) FloatCurves = JsonObject->GetObjectField(TEXT("CompressedCurveData"))->GetArrayField(TEXT("FloatCurves"));
 
-	for (TSharedPtr<FJsonValue> FloatCurveObject : FloatCurves)
+	// Keys of every curve are converted up front, off the game thread
+	const bool bSingleThreaded = !CanReadJsonOffGameThread();
+
+	TArray<TArray<FRichCurveKey>> CurveKeys;
+	CurveKeys.SetNum(FloatCurves.Num());
+
+	float Tolerance;
+	const bool bReduceKeys = FCurveKeyReduction::IsEnabled(Tolerance);
+
+	TArray<FCurveKeyReductionResult> Reductions;
+	Reductions.SetNum(FloatCurves.Num());
+
+	ParallelFor(FloatCurves.Num(), [&FloatCurves, &CurveKeys, &Reductions, bReduceKeys, Tolerance](const int32 CurveIndex) {
+		const TArray<TSharedPtr<FJsonValue>>& Keys = FloatCurves[CurveIndex]->AsObject()->GetObjectField(TEXT("FloatCurve"))->GetArrayField(TEXT("Keys"));
+
+		TArray<FRichCurveKey>& RichKeys = CurveKeys[CurveIndex];
+		FMathUtilities::ObjectsToRichCurveKeys(Keys, RichKeys);
+
+		if (bReduceKeys) {
+			Reductions[CurveIndex] = FCurveKeyReduction::ReduceKeys(RichKeys, Tolerance);
+		}
+	}, bSingleThreaded);
+
+	if (bReduceKeys && FloatCurves.Num() > 0) {
+		FCurveKeyReductionResult Reduction;
+
+		for (const FCurveKeyReductionResult& CurveReduction : Reductions) {
+			Reduction.Append(CurveReduction);
+		}
+
+		FCurveKeyReduction::Report(AssetName, Reduction);
+	}
+
+	for (int32 CurveIndex = 0; CurveIndex < FloatCurves.Num(); CurveIndex++)
 	{
+		const TSharedPtr<FJsonValue>& FloatCurveObject = FloatCurves[CurveIndex];
+
 		// Display Name (for example: jaw_open_pose)
 		FString DisplayName = "";
 		if (FloatCurveObject->AsObject()->HasField(TEXT("Name"))) {
@@ -161,43 +190,27 @@ bool IAnimationBaseImporter::Import() {
 #endif
 #endif
 
-		// Each key of the curve
-		TArray<TSharedPtr<FJsonValue>> Keys = FloatCurveObject->AsObject()->GetObjectField(TEXT("FloatCurve"))->GetArrayField(TEXT("Keys"));
-
-		for (TSharedPtr<FJsonValue> JsonKey : Keys) {
-			TSharedPtr<FJsonObject> Key = JsonKey->AsObject();
-
-			FRichCurveKey RichKey = FMathUtilities::ObjectToRichCurveKey(Key);
-
-			// Unreal Engine 5 and Unreal Engine 4
-			// have different ways of adding curves
-			//
-			// Unreal Engine 4: Simply adding curves to RawCurveData
-			// Unreal Engine 5: Using a AnimDataController to handle adding curves
+		// Every key of the curve is set in one call, auto tangents are set
+		// once all of them are in, the exported tangent modes are kept
+		//
+		// Unreal Engine 5 and Unreal Engine 4
+		// have different ways of adding curves
+		//
+		// Unreal Engine 4: Simply adding curves to RawCurveData
+		// Unreal Engine 5: Using a AnimDataController to handle adding curves
 #if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 2
-			Controller.SetCurveKey(CurveId, RichKey);
-#endif
-#if ENGINE_MAJOR_VERSION == 4
-			FRawCurveTracks& Tracks = AnimSequenceBase->RawCurveData;
+		Controller.SetCurveKeys(CurveId, CurveKeys[CurveIndex]);
 #endif
 #if ENGINE_MAJOR_VERSION == 4
-			Tracks.AddFloatCurveKey(NewTrackName, CurveTypeFlags, RichKey.Time, RichKey.Value);
-
-			for (FFloatCurve& Track : Tracks.FloatCurves)
-			{
-				if (Track.Name == NewTrackName)
-				{
-					int32 LastIndex = Track.FloatCurve.Keys.Num() - 1;
-					Track.FloatCurve.Keys[LastIndex].ArriveTangent = RichKey.ArriveTangent;
-					Track.FloatCurve.Keys[LastIndex].LeaveTangent = RichKey.LeaveTangent;
-					Track.FloatCurve.Keys[LastIndex].InterpMode = RichKey.InterpMode;
-				}
-			}
-#endif
-#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION < 2
-#endif
+		FRawCurveTracks& Tracks = AnimSequenceBase->RawCurveData;
+		Tracks.AddCurveData(NewTrackName, CurveTypeFlags);
 
+		if (FFloatCurve* Track = static_cast<FFloatCurve*>(Tracks.GetCurveData(NewTrackName.UID, ERawCurveTrackTypes::RCT_Float)))
+		{
+			Track->FloatCurve.Keys = MoveTemp(CurveKeys[CurveIndex]);
+			Track->FloatCurve.AutoSetTangents();
 		}
+#endif
 #if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 2
 		Controller.CloseBracket();
 #endif
@@ -237,17 +250,18 @@ bool IAnimationBaseImporter::Import() {
 		"CompositeSections"
 	}), AnimSequenceBase);
 
-#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 2
-	if (ITargetPlatform* RunningPlatform = GetTargetPlatformManagerRef().GetRunningTargetPlatform())
+	// Within a batch, sequences are compressed together once the batch ends
+	if (CastedAnimSequence && !FAnimationCompressionBatch::Defer(CastedAnimSequence))
 	{
-		CastedAnimSequence->CacheDerivedData(RunningPlatform);
-	}
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 2
+		if (ITargetPlatform* RunningPlatform = GetTargetPlatformManagerRef().GetRunningTargetPlatform())
+		{
+			CastedAnimSequence->CacheDerivedData(RunningPlatform);
+		}
 #else
-	if (CastedAnimSequence)
-	{
 		CastedAnimSequence->RequestSyncAnimRecompression();
-	}
 #endif
+	}
 
 #if ENGINE_MAJOR_VERSION == 4
 	AnimSequenceBase->MarkRawDataAsModified();
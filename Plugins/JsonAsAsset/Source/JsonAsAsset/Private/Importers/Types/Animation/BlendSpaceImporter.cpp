@@ -2,41 +2,81 @@
 
 #include "Importers/Types/Animation/BlendSpaceImporter.h"
 #include "Utilities/MathUtilities.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Misc/PackageName.h"
 
 bool IBlendSpaceImporter::Import() {
 	TSharedPtr<FJsonObject> AssetData = JsonObject->GetObjectField(TEXT("Properties"));
 	UBlendSpace* BlendSpace = NewObject<UBlendSpace>(Package, UBlendSpace::StaticClass(), *FileName, RF_Public | RF_Standalone);
 	
-	BlendSpace->Modify();
-
 	/* Cast to an object class to access variables */
 	CBlendSpaceDerived* BlendSpaceDerived = Cast<CBlendSpaceDerived>(BlendSpace);
 
-	auto SampleData = AssetData->GetArrayField(TEXT("SampleData"));
+	const TArray<TSharedPtr<FJsonValue>> SampleData = AssetData->GetArrayField(TEXT("SampleData"));
+
+	TArray<TSharedPtr<FJsonObject>> SampleObjects;
+	TArray<FName> AnimationPackages;
+	SampleObjects.Reserve(SampleData.Num());
+	AnimationPackages.Reserve(SampleData.Num());
 
-	/* Add samples */
 	for (const TSharedPtr<FJsonValue>& JsonObjectValue : SampleData) {
 		const TSharedPtr<FJsonObject> JsonObjectVal = JsonObjectValue->AsObject();
+		if (!JsonObjectVal.IsValid()) continue;
+
+		FName AnimationPackage = NAME_None;
+		const TSharedPtr<FJsonObject>* AnimationJsonObject;
 
-		if (JsonObjectVal.IsValid()) {
-			auto AnimationJsonObject = JsonObjectVal->GetObjectField(TEXT("Animation"));
+		if (JsonObjectVal->TryGetObjectField(TEXT("Animation"), AnimationJsonObject)) {
+			AnimationPackage = FName(*GetPackagePath(AnimationJsonObject->Get()->GetStringField(TEXT("ObjectPath"))));
+		}
 
-			FString AnimationPath = AnimationJsonObject->GetStringField(TEXT("ObjectPath")).Replace(TEXT("FortniteGame/Content"), TEXT("/Game"));
-			AnimationPath.Split(".", &AnimationPath, nullptr);
+		SampleObjects.Add(JsonObjectVal);
+		AnimationPackages.Add(AnimationPackage);
+	}
 
-			UObject* Object = StaticLoadObject(UObject::StaticClass(), nullptr, *AnimationPath);
+	/* Every sample animation is looked up in one asset registry query */
+	FARFilter Filter;
+	Filter.PackageNames = AnimationPackages;
+	Filter.PackageNames.Remove(NAME_None);
 
-			BlendSpace->Modify();
-			BlendSpaceDerived->CreateNewSample(Cast<UAnimSequence>(Object), FMathUtilities::ObjectToVector(JsonObjectVal->GetObjectField(TEXT("SampleValue")).Get()));
-			BlendSpace->PostEditChange();
+	TArray<FAssetData> AssetDataList;
+	if (Filter.PackageNames.Num() > 0) {
+		const FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+		AssetRegistryModule.Get().GetAssets(Filter, AssetDataList);
+	}
+
+	TMap<FName, UAnimSequence*> Animations;
+	for (const FAssetData& Asset : AssetDataList) {
+		if (Animations.Contains(Asset.PackageName)) continue;
+
+		if (UAnimSequence* Animation = Cast<UAnimSequence>(Asset.GetAsset())) {
+			Animations.Add(Asset.PackageName, Animation);
 		}
 	}
 
-	/* Ensure internal state is refreshed after adding all samples */
-	BlendSpace->ValidateSampleData();
-	BlendSpace->MarkPackageDirty();
-	BlendSpace->PostEditChange();
-	
+	// Packages the registry hasn't scanned yet, like animations imported earlier in the batch, are loaded directly
+	for (const FName& PackageName : Filter.PackageNames) {
+		if (Animations.Contains(PackageName)) continue;
+
+		const FString PackagePath = PackageName.ToString();
+
+		if (UAnimSequence* Animation = Cast<UAnimSequence>(StaticLoadObject(UAnimSequence::StaticClass(), nullptr, *(PackagePath + "." + FPackageName::GetShortName(PackagePath))))) {
+			Animations.Add(PackageName, Animation);
+		}
+	}
+
+	TArray<FBlendSample> Samples;
+	Samples.Reserve(SampleObjects.Num());
+
+	for (int32 Index = 0; Index < SampleObjects.Num(); Index++) {
+		UAnimSequence* const* Animation = Animations.Find(AnimationPackages[Index]);
+
+		Samples.Add(FBlendSample(Animation ? *Animation : nullptr, FMathUtilities::ObjectToVector(SampleObjects[Index]->GetObjectField(TEXT("SampleValue")).Get()), true, true));
+	}
+
+	BlendSpaceDerived->SetSamples(MoveTemp(Samples));
+
+	/* Sample data is validated and the triangulation built once, by the PostEditChange in OnAssetCreation */
 	GetObjectSerializer()->DeserializeObjectProperties(RemovePropertiesShared(AssetData,
 	{
 		"SampleData",
@@ -46,8 +86,8 @@ bool IBlendSpaceImporter::Import() {
 	return OnAssetCreation(BlendSpace);
 }
 
-void CBlendSpaceDerived::CreateNewSample(UAnimSequence* AnimationSequence, const FVector& SampleValue) {
-	SampleData.Add(FBlendSample(AnimationSequence, SampleValue, true, true));
-	
+void CBlendSpaceDerived::SetSamples(TArray<FBlendSample>&& Samples) {
+	SampleData = MoveTemp(Samples);
+
 	PreviewBasePose = nullptr;
 }
\ No newline at end of file
@@ -17,6 +17,9 @@ bool ISoundCueImporter::Import() {
 			
 			ConstructNodes(SoundCue, AllJsonObjects, SoundCueNodes);
 			SetupNodes(SoundCue, SoundCueNodes, AllJsonObjects);
+
+			// Every pin is linked in one pass from the child nodes
+			SoundCue->LinkGraphNodesFromSoundNodes();
 		}
 		// END ---------------------------------------------
 
@@ -25,7 +28,7 @@ bool ISoundCueImporter::Import() {
 			"FirstNode"
 		}), SoundCue);
 		
-		SoundCue->PostEditChange();
+		// Edit change is handled once by the asset creation
 		SoundCue->CompileSoundNodesFromGraphNodes();
 
 		return OnAssetCreation(SoundCue);
@@ -2,6 +2,7 @@
 
 #include "Importers/Types/Curves/CurveFloatImporter.h"
 #include "Utilities/MathUtilities.h"
+#include "Utilities/CurveKeyReduction.h"
 #include "Factories/CurveFactory.h"
 #include "Dom/JsonObject.h"
 
@@ -13,10 +14,16 @@ bool ICurveFloatImporter::Import() {
 	UCurveFloat* CurveAsset = Cast<UCurveFloat>(CurveFactory->FactoryCreateNew(UCurveFloat::StaticClass(), OutermostPkg, *FileName, RF_Standalone | RF_Public, nullptr, GWarn));
 
 	// Add Rich Keys
-	for (TSharedPtr<FJsonValue>& Key : Keys) {
-		CurveAsset->FloatCurve.Keys.Add(FMathUtilities::ObjectToRichCurveKey(Key->AsObject()));
+	TArray<FRichCurveKey> RichKeys;
+	FMathUtilities::ObjectsToRichCurveKeys(Keys, RichKeys);
+
+	float Tolerance;
+	if (FCurveKeyReduction::IsEnabled(Tolerance)) {
+		FCurveKeyReduction::Report(FileName, FCurveKeyReduction::ReduceKeys(RichKeys, Tolerance));
 	}
 
+	CurveAsset->FloatCurve.Keys = MoveTemp(RichKeys);
+
 	// Handle edit changes, and add it to the content browser
 	return OnAssetCreation(CurveAsset);
 }
\ No newline at end of file
@@ -3,29 +3,13 @@
 #include "Importers/Types/Curves/CurveLinearColorAtlasImporter.h"
 #include "Curves/CurveLinearColorAtlas.h"
 #include "Curves/CurveLinearColor.h"
+#include "Async/ParallelFor.h"
 #include "Dom/JsonObject.h"
 
 bool ICurveLinearColorAtlasImporter::Import() {
 	TSharedPtr<FJsonObject> Properties = JsonObject->GetObjectField(TEXT("Properties"));
-	
-	float Width = 256;
-	float Height = 256;
 
 	UCurveLinearColorAtlas* Object = NewObject<UCurveLinearColorAtlas>(Package, UCurveLinearColorAtlas::StaticClass(), *FileName, RF_Public | RF_Standalone);
-	Object->Source.Init(Width, Height, 1, 1, TSF_RGBA16F);
-	const int32 TextureDataSize = Object->Source.CalcMipSize(0);
-	Object->SrcData.AddUninitialized(TextureDataSize);
-	uint32* TextureData = (uint32*)Object->Source.LockMip(0);
-	FFloat16Color InitColor(FLinearColor::White);
-	for (uint32 y = 0; y < Object->TextureSize; y++) {
-		for (uint32 x = 0; x < Object->TextureSize; x++) {
-			Object->SrcData[x * Object->TextureSize + y] = InitColor;
-		}
-	}
-	FMemory::Memcpy(TextureData, Object->SrcData.GetData(), TextureDataSize);
-	Object->Source.UnlockMip(0);
-
-	Object->UpdateResource();
 
 	bool bHasAnyDirtyTextures = false;
 	if (Properties->TryGetBoolField(TEXT("bHasAnyDirtyTextures"), bHasAnyDirtyTextures))
@@ -69,33 +53,67 @@ bool ICurveLinearColorAtlasImporter::Import() {
 		Object->TextureHeight = TextureHeight;
 	}
 
-	FProperty* TextureSizeProperty = FindFProperty<FProperty>(Object->GetClass(), "TextureSize");
-	FPropertyChangedEvent TextureSizePropertyPropertyChangedEvent(TextureSizeProperty, EPropertyChangeType::ValueSet);
-	Object->PostEditChangeProperty(TextureSizePropertyPropertyChangedEvent);
-
-	// Add gradient curves
-	FProperty* GradientCurvesProperty = FindFProperty<FProperty>(Object->GetClass(), "GradientCurves");
-	FPropertyChangedEvent PropertyChangedEvent(GradientCurvesProperty, EPropertyChangeType::ArrayAdd);
+	if (Object->bSquareResolution)
+	{
+		Object->TextureHeight = Object->TextureSize;
+	}
 
+	// Every gradient curve is resolved in one go
 	const TArray<TSharedPtr<FJsonValue>> GradientCurves = Properties->GetArrayField(TEXT("GradientCurves"));
 	TArray<TObjectPtr<UCurveLinearColor>> CurvesLocal;
 
-#if ENGINE_MAJOR_VERSION >= 5
-	CurvesLocal = LoadObject(GradientCurves, CurvesLocal);
-	Object->GradientCurves = CurvesLocal;
-	Object->PostEditChangeProperty(PropertyChangedEvent);
-#else
 	CurvesLocal = LoadObject(GradientCurves, CurvesLocal);
 
-	// Convert TObjectPtr<UCurveLinearColor> to UCurveLinearColor* and assign to Object->GradientCurves
 	TArray<UCurveLinearColor*> RawCurves;
+	RawCurves.Reserve(CurvesLocal.Num());
+
 	for (const TObjectPtr<UCurveLinearColor>& Curve : CurvesLocal) {
 		RawCurves.Add(Curve.Get());
 	}
 
+#if ENGINE_MAJOR_VERSION >= 5
+	Object->GradientCurves = CurvesLocal;
+#else
 	Object->GradientCurves = RawCurves;
 #endif
 
+	// Same binding the atlas makes when its curves are edited, without rebuilding the texture for it
+	for (UCurveLinearColor* Curve : RawCurves) {
+		if (Curve != nullptr) {
+			Curve->OnUpdateCurve.AddUObject(Object, &UCurveLinearColorAtlas::OnCurveUpdated);
+		}
+	}
+
+	// Rasterize the atlas once, at its final size, one gradient per row
+	const uint32 Width = Object->TextureSize;
+	const uint32 Height = Object->TextureHeight;
+
+	Object->Source.Init(Width, Height, 1, 1, TSF_RGBA16F);
+	Object->SrcData.SetNumUninitialized(Width * Height);
+
+	const int32 NumSlots = FMath::Min(RawCurves.Num(), static_cast<int32>(Height));
+
+	ParallelFor(static_cast<int32>(Height), [Object, &RawCurves, Width, NumSlots](const int32 Row) {
+		const int32 RowStart = Row * Width;
+
+		// Same values UpdateTextures writes, each gradient only writes its own row
+		if (Row < NumSlots && RawCurves[Row] != nullptr) {
+			RawCurves[Row]->PushToSourceData(Object->SrcData, RowStart, FVector2D(Width, 1));
+
+			return;
+		}
+
+		const FFloat16Color InitColor(FLinearColor::White);
+
+		for (uint32 X = 0; X < Width; X++) {
+			Object->SrcData[RowStart + X] = InitColor;
+		}
+	});
+
+	uint32* TextureData = (uint32*)Object->Source.LockMip(0);
+	FMemory::Memcpy(TextureData, Object->SrcData.GetData(), Object->SrcData.Num() * sizeof(FFloat16Color));
+	Object->Source.UnlockMip(0);
+
 	// Handle edit changes, and add it to the content browser
 	return OnAssetCreation(Object);
-}
\ No newline at end of file
+}
@@ -14,14 +14,16 @@ bool ICurveLinearColorImporter::Import() {
 	UCurveLinearColor* LinearCurveAsset = Cast<UCurveLinearColor>(CurveFactory->FactoryCreateNew(UCurveLinearColor::StaticClass(), OutermostPkg, *FileName, RF_Standalone | RF_Public, nullptr, GWarn));
 
 	// for each container, get keys
-	for (int i = 0; i < FloatCurves.Num(); i++) {
-		TArray<TSharedPtr<FJsonValue>> Keys = FloatCurves[i]->AsObject()->GetArrayField(TEXT("Keys"));
-		LinearCurveAsset->FloatCurves[i].Keys.Empty();
-
-		// add keys to array
-		for (int j = 0; j < Keys.Num(); j++) {
-			LinearCurveAsset->FloatCurves[i].Keys.Add(FMathUtilities::ObjectToRichCurveKey(Keys[j]->AsObject()));
-		}
+	const int32 NumCurves = FMath::Min(FloatCurves.Num(), static_cast<int32>(UE_ARRAY_COUNT(LinearCurveAsset->FloatCurves)));
+
+	for (int i = 0; i < NumCurves; i++) {
+		const TArray<TSharedPtr<FJsonValue>>& Keys = FloatCurves[i]->AsObject()->GetArrayField(TEXT("Keys"));
+
+		// all keys of the channel, assigned at once
+		TArray<FRichCurveKey> RichKeys;
+		FMathUtilities::ObjectsToRichCurveKeys(Keys, RichKeys);
+
+		LinearCurveAsset->FloatCurves[i].Keys = MoveTemp(RichKeys);
 	}
 
 	return OnAssetCreation(LinearCurveAsset);
@@ -2,6 +2,7 @@
 
 #include "Importers/Types/Curves/CurveVectorImporter.h"
 #include "Utilities/MathUtilities.h"
+#include "Utilities/CurveKeyReduction.h"
 #include "Factories/CurveFactory.h"
 #include "Curves/CurveVector.h"
 
@@ -12,15 +13,29 @@ bool ICurveVectorImporter::Import() {
 	UCurveVectorFactory* CurveVectorFactory = NewObject<UCurveVectorFactory>();
 	UCurveVector* CurveVectorAsset = Cast<UCurveVector>(CurveVectorFactory->FactoryCreateNew(UCurveVector::StaticClass(), OutermostPkg, *FileName, RF_Standalone | RF_Public, nullptr, GWarn));
 
+	float Tolerance;
+	const bool bReduceKeys = FCurveKeyReduction::IsEnabled(Tolerance);
+	FCurveKeyReductionResult Reduction;
+
 	// for each container, get keys
-	for (int i = 0; i < FloatCurves.Num(); i++) {
-		TArray<TSharedPtr<FJsonValue>> Keys = FloatCurves[i]->AsObject()->GetArrayField(TEXT("Keys"));
-		CurveVectorAsset->FloatCurves[i].Keys.Empty();
+	const int32 NumCurves = FMath::Min(FloatCurves.Num(), static_cast<int32>(UE_ARRAY_COUNT(CurveVectorAsset->FloatCurves)));
+
+	for (int i = 0; i < NumCurves; i++) {
+		const TArray<TSharedPtr<FJsonValue>>& Keys = FloatCurves[i]->AsObject()->GetArrayField(TEXT("Keys"));
+
+		// all keys of the channel, assigned at once
+		TArray<FRichCurveKey> RichKeys;
+		FMathUtilities::ObjectsToRichCurveKeys(Keys, RichKeys);
 
-		// add keys to array
-		for (int j = 0; j < Keys.Num(); j++) {
-			CurveVectorAsset->FloatCurves[i].Keys.Add(FMathUtilities::ObjectToRichCurveKey(Keys[j]->AsObject()));
+		if (bReduceKeys) {
+			Reduction.Append(FCurveKeyReduction::ReduceKeys(RichKeys, Tolerance));
 		}
+
+		CurveVectorAsset->FloatCurves[i].Keys = MoveTemp(RichKeys);
+	}
+
+	if (bReduceKeys) {
+		FCurveKeyReduction::Report(FileName, Reduction);
 	}
 
 	// Handle edit changes, and add it to the content browser
@@ -2,6 +2,7 @@
 
 #include "Importers/Types/Materials/MaterialFunctionImporter.h"
 #include "Factories/MaterialFunctionFactoryNew.h"
+#include "Utilities/MaterialCompileBatch.h"
 
 bool IMaterialFunctionImporter::Import() {
 	// Create Material Function Factory (factory automatically creates the MF)
@@ -58,7 +59,8 @@ bool IMaterialFunctionImporter::Import() {
 	MaterialGraphNode_ConstructComments(MaterialFunction, StringExpressionCollection, Exports);
 
 	MaterialFunction->PreEditChange(NULL);
-	MaterialFunction->PostEditChange();
+	if (!FMaterialCompileBatch::Defer(MaterialFunction))
+		MaterialFunction->PostEditChange();
 
 	SavePackage();
 
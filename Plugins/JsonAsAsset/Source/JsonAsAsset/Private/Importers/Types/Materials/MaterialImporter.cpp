@@ -18,6 +18,7 @@
 
 #include "Editor/MaterialEditor/Private/MaterialEditor.h"
 #include "Settings/JsonAsAssetSettings.h"
+#include "Utilities/MaterialCompileBatch.h"
 
 #if ENGINE_MAJOR_VERSION >= 5
 #include <Editor/UnrealEd/Classes/MaterialGraph/MaterialGraphNode_Composite.h>
@@ -371,9 +372,11 @@ bool IMaterialImporter::Import() {
 	if (Properties->TryGetStringField(TEXT("ShadingModel"), ShadingModel) && ShadingModel != "EMaterialShadingModel::MSM_FromMaterialExpression")
 		Material->SetShadingModel(static_cast<EMaterialShadingModel>(StaticEnum<EMaterialShadingModel>()->GetValueByNameString(ShadingModel)));
 
-	Material->ForceRecompileForRendering();
+	if (!FMaterialCompileBatch::Defer(Material)) {
+		Material->ForceRecompileForRendering();
 
-	Material->PostEditChange();
+		Material->PostEditChange();
+	}
 	Material->MarkPackageDirty();
 	Material->PreEditChange(nullptr);
 
@@ -6,6 +6,7 @@
 #include "Dom/JsonObject.h"
 #include "RHIDefinitions.h"
 #include "MaterialShared.h"
+#include "Utilities/MaterialCompileBatch.h"
 
 bool IMaterialInstanceConstantImporter::Import() {
 	TSharedPtr<FJsonObject> Properties = JsonObject->GetObjectField(TEXT("Properties"));
@@ -29,13 +30,23 @@ bool IMaterialInstanceConstantImporter::Import() {
 
 	const TSharedPtr<FJsonObject>* ParentPtr;
 	if (Properties->TryGetObjectField(TEXT("Parent"), ParentPtr)) {
+		const FString ParentPath = ParentPtr->Get()->GetStringField(TEXT("ObjectPath"));
+
+		/* Instances in a batch mostly share a few parents, each chain is resolved once */
+		UMaterialInterface* CachedParent;
+		if (FMaterialCompileBatch::FindParent(ParentPath, CachedParent)) {
+			MaterialInstanceConstant->Parent = CachedParent;
+		} else {
 #if ENGINE_MAJOR_VERSION >= 5
-		LoadObject(ParentPtr, MaterialInstanceConstant->Parent);
+			LoadObject(ParentPtr, MaterialInstanceConstant->Parent);
 #else
-		TObjectPtr<UMaterialInterface> ParentObjectPtr;
-		LoadObject(ParentPtr, ParentObjectPtr);
-		MaterialInstanceConstant->Parent = ParentObjectPtr.Get();
+			TObjectPtr<UMaterialInterface> ParentObjectPtr;
+			LoadObject(ParentPtr, ParentObjectPtr);
+			MaterialInstanceConstant->Parent = ParentObjectPtr.Get();
 #endif
+
+			FMaterialCompileBatch::AddParent(ParentPath, MaterialInstanceConstant->Parent);
+		}
 	}
 
 	const TSharedPtr<FJsonObject>* SubsurfaceProfilePtr;
@@ -53,79 +64,48 @@ bool IMaterialInstanceConstantImporter::Import() {
 	if (Properties->TryGetBoolField(TEXT("bOverrideSubsurfaceProfile"), bOverrideSubsurfaceProfile))
 		MaterialInstanceConstant->bOverrideSubsurfaceProfile = bOverrideSubsurfaceProfile;
 
+	// Parameters are read into arrays sized up front, and set once per type
+	const TArray<TSharedPtr<FJsonValue>>& Scalars = Properties->GetArrayField(TEXT("ScalarParameterValues"));
+
 	TArray<FScalarParameterValue> ScalarParameterValues;
-	TArray<TSharedPtr<FJsonValue>> Scalars = Properties->GetArrayField(TEXT("ScalarParameterValues"));
+	ScalarParameterValues.Reserve(Scalars.Num());
 
-	for (int32 i = 0; i < Scalars.Num(); i++) {
-		TSharedPtr<FJsonObject> Scalar = Scalars[i]->AsObject();
+	for (const TSharedPtr<FJsonValue>& Value : Scalars) {
+		const TSharedPtr<FJsonObject> Scalar = Value->AsObject();
 
-		FScalarParameterValue Parameter;
+		FScalarParameterValue& Parameter = ScalarParameterValues.AddDefaulted_GetRef();
 		Parameter.ParameterValue = Scalar->GetNumberField(TEXT("ParameterValue"));
 		Parameter.ExpressionGUID = FGuid(Scalar->GetStringField(TEXT("ExpressionGUID")));
+		Parameter.ParameterInfo = ReadParameterInfo(Scalar);
+	}
 
-		const TSharedPtr<FJsonObject>* ParameterInfoPtr;
-		if (Scalar->TryGetObjectField(TEXT("ParameterInfo"), ParameterInfoPtr)) {
-			TSharedPtr<FJsonObject> ParameterInfoJson = Scalar->GetObjectField(TEXT("ParameterInfo"));
-			FMaterialParameterInfo ParameterInfo;
-			ParameterInfo.Index = ParameterInfoJson->GetIntegerField(TEXT("Index"));
-			ParameterInfo.Name = FName(ParameterInfoJson->GetStringField(TEXT("Name")));
-			ParameterInfo.Association = GlobalParameter;
-
-			Parameter.ParameterInfo = ParameterInfo;
-		} else {
-			FMaterialParameterInfo ParameterInfo;
-			ParameterInfo.Index = -1;
-			ParameterInfo.Name = FName(Scalar->GetStringField(TEXT("ParameterName")));
-			ParameterInfo.Association = GlobalParameter;
+	MaterialInstanceConstant->ScalarParameterValues = MoveTemp(ScalarParameterValues);
 
-			Parameter.ParameterInfo = ParameterInfo;
-		}
-
-		ScalarParameterValues.Add(Parameter);
-	}
+	const TArray<TSharedPtr<FJsonValue>>& Vectors = Properties->GetArrayField(TEXT("VectorParameterValues"));
 
-	MaterialInstanceConstant->ScalarParameterValues = ScalarParameterValues;
 	TArray<FVectorParameterValue> VectorParameterValues;
+	VectorParameterValues.Reserve(Vectors.Num());
 
-	TArray<TSharedPtr<FJsonValue>> Vectors = Properties->GetArrayField(TEXT("VectorParameterValues"));
-	for (int32 i = 0; i < Vectors.Num(); i++) {
-		TSharedPtr<FJsonObject> Vector = Vectors[i]->AsObject();
+	for (const TSharedPtr<FJsonValue>& Value : Vectors) {
+		const TSharedPtr<FJsonObject> Vector = Value->AsObject();
 
-		FVectorParameterValue Parameter;
+		FVectorParameterValue& Parameter = VectorParameterValues.AddDefaulted_GetRef();
 		Parameter.ExpressionGUID = FGuid(Vector->GetStringField(TEXT("ExpressionGUID")));
-
 		Parameter.ParameterValue = FMathUtilities::ObjectToLinearColor(Vector->GetObjectField(TEXT("ParameterValue")).Get());
+		Parameter.ParameterInfo = ReadParameterInfo(Vector);
+	}
 
-		const TSharedPtr<FJsonObject>* ParameterInfoPtr;
-		
-		if (Vector->TryGetObjectField(TEXT("ParameterInfo"), ParameterInfoPtr)) {
-			TSharedPtr<FJsonObject> ParameterInfoJson = Vector->GetObjectField(TEXT("ParameterInfo"));
-			FMaterialParameterInfo ParameterInfo;
-			ParameterInfo.Index = ParameterInfoJson->GetIntegerField(TEXT("Index"));
-			ParameterInfo.Name = FName(ParameterInfoJson->GetStringField(TEXT("Name")));
-			ParameterInfo.Association = GlobalParameter;
-
-			Parameter.ParameterInfo = ParameterInfo;
-		} else {
-			FMaterialParameterInfo ParameterInfo;
-			ParameterInfo.Index = -1;
-			ParameterInfo.Name = FName(Vector->GetStringField(TEXT("ParameterName")));
-			ParameterInfo.Association = GlobalParameter;
+	MaterialInstanceConstant->VectorParameterValues = MoveTemp(VectorParameterValues);
 
-			Parameter.ParameterInfo = ParameterInfo;
-		}
+	const TArray<TSharedPtr<FJsonValue>>& Textures = Properties->GetArrayField(TEXT("TextureParameterValues"));
 
-		VectorParameterValues.Add(Parameter);
-	}
-
-	MaterialInstanceConstant->VectorParameterValues = VectorParameterValues;
 	TArray<FTextureParameterValue> TextureParameterValues;
+	TextureParameterValues.Reserve(Textures.Num());
 
-	TArray<TSharedPtr<FJsonValue>> Textures = Properties->GetArrayField(TEXT("TextureParameterValues"));
-	for (int32 i = 0; i < Textures.Num(); i++) {
-		TSharedPtr<FJsonObject> Texture = Textures[i]->AsObject();
+	for (const TSharedPtr<FJsonValue>& Value : Textures) {
+		const TSharedPtr<FJsonObject> Texture = Value->AsObject();
 
-		FTextureParameterValue Parameter;
+		FTextureParameterValue& Parameter = TextureParameterValues.AddDefaulted_GetRef();
 		Parameter.ExpressionGUID = FGuid(Texture->GetStringField(TEXT("ExpressionGUID")));
 
 		const TSharedPtr<FJsonObject>* TexturePtr = nullptr;
@@ -139,29 +119,10 @@ bool IMaterialInstanceConstantImporter::Import() {
 #endif
 		}
 
-		const TSharedPtr<FJsonObject>* ParameterInfoPtr;
-		
-		if (Texture->TryGetObjectField(TEXT("ParameterInfo"), ParameterInfoPtr)) {
-			TSharedPtr<FJsonObject> ParameterInfoJson = Texture->GetObjectField(TEXT("ParameterInfo"));
-			FMaterialParameterInfo ParameterInfo;
-			ParameterInfo.Index = ParameterInfoJson->GetIntegerField(TEXT("Index"));
-			ParameterInfo.Name = FName(ParameterInfoJson->GetStringField(TEXT("Name")));
-			ParameterInfo.Association = GlobalParameter;
-
-			Parameter.ParameterInfo = ParameterInfo;
-		} else {
-			FMaterialParameterInfo ParameterInfo;
-			ParameterInfo.Index = -1;
-			ParameterInfo.Name = FName(Texture->GetStringField(TEXT("ParameterName")));
-			ParameterInfo.Association = GlobalParameter;
-
-			Parameter.ParameterInfo = ParameterInfo;
-		}
-
-		TextureParameterValues.Add(Parameter);
+		Parameter.ParameterInfo = ReadParameterInfo(Texture);
 	}
 
-	MaterialInstanceConstant->TextureParameterValues = TextureParameterValues;
+	MaterialInstanceConstant->TextureParameterValues = MoveTemp(TextureParameterValues);
 
 	TArray<TSharedPtr<FJsonValue>> Local_StaticParameterObjects;
 	TArray<TSharedPtr<FJsonValue>> Local_StaticComponentMaskParametersObjects;
@@ -254,11 +215,66 @@ bool IMaterialInstanceConstantImporter::Import() {
 	}
 
 #if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 2
-	FMaterialUpdateContext MaterialUpdateContext(FMaterialUpdateContext::EOptions::Default & ~FMaterialUpdateContext::EOptions::RecreateRenderStates);
+	// Switches that all match the parent need no permutation of their own, so no recompile either
+	FStaticParameterSet ParentStaticParameterSet;
+	if (!Properties->HasField(TEXT("BasePropertyOverrides")) && FMaterialCompileBatch::GetParentStaticParameters(MaterialInstanceConstant->Parent, ParentStaticParameterSet)
+		&& StaticParametersMatchParent(NewStaticParameterSet, ParentStaticParameterSet)) {
+		FMaterialCompileBatch::SkipRecompile(MaterialInstanceConstant);
+	}
+
+	if (!FMaterialCompileBatch::DeferStaticPermutation(MaterialInstanceConstant, NewStaticParameterSet)) {
+		FMaterialUpdateContext MaterialUpdateContext(FMaterialUpdateContext::EOptions::Default & ~FMaterialUpdateContext::EOptions::RecreateRenderStates);
 
-	MaterialInstanceConstant->UpdateStaticPermutation(NewStaticParameterSet, &MaterialUpdateContext);
-	MaterialInstanceConstant->InitStaticPermutation();
+		MaterialInstanceConstant->UpdateStaticPermutation(NewStaticParameterSet, &MaterialUpdateContext);
+		MaterialInstanceConstant->InitStaticPermutation();
+	}
 #endif
 
 	return OnAssetCreation(MaterialInstanceConstant);
 }
+
+FMaterialParameterInfo IMaterialInstanceConstantImporter::ReadParameterInfo(const TSharedPtr<FJsonObject>& Parameter) {
+	FMaterialParameterInfo ParameterInfo;
+	ParameterInfo.Association = GlobalParameter;
+
+	const TSharedPtr<FJsonObject>* ParameterInfoPtr;
+	if (Parameter->TryGetObjectField(TEXT("ParameterInfo"), ParameterInfoPtr)) {
+		ParameterInfo.Index = ParameterInfoPtr->Get()->GetIntegerField(TEXT("Index"));
+		ParameterInfo.Name = FName(ParameterInfoPtr->Get()->GetStringField(TEXT("Name")));
+	} else {
+		ParameterInfo.Index = -1;
+		ParameterInfo.Name = FName(Parameter->GetStringField(TEXT("ParameterName")));
+	}
+
+	return ParameterInfo;
+}
+
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 2
+bool IMaterialInstanceConstantImporter::StaticParametersMatchParent(const FStaticParameterSet& StaticParameters, const FStaticParameterSet& ParentStaticParameters) {
+	for (const FStaticSwitchParameter& Parameter : StaticParameters.StaticSwitchParameters) {
+		if (!Parameter.bOverride) continue;
+
+		const FStaticSwitchParameter* ParentParameter = ParentStaticParameters.StaticSwitchParameters.FindByPredicate([&Parameter](const FStaticSwitchParameter& Other) {
+			return Other.ParameterInfo == Parameter.ParameterInfo;
+		});
+
+		if (ParentParameter == nullptr || ParentParameter->Value != Parameter.Value) {
+			return false;
+		}
+	}
+
+	for (const FStaticComponentMaskParameter& Parameter : StaticParameters.EditorOnly.StaticComponentMaskParameters) {
+		if (!Parameter.bOverride) continue;
+
+		const FStaticComponentMaskParameter* ParentParameter = ParentStaticParameters.EditorOnly.StaticComponentMaskParameters.FindByPredicate([&Parameter](const FStaticComponentMaskParameter& Other) {
+			return Other.ParameterInfo == Parameter.ParameterInfo;
+		});
+
+		if (ParentParameter == nullptr || ParentParameter->R != Parameter.R || ParentParameter->G != Parameter.G || ParentParameter->B != Parameter.B || ParentParameter->A != Parameter.A) {
+			return false;
+		}
+	}
+
+	return true;
+}
+#endif
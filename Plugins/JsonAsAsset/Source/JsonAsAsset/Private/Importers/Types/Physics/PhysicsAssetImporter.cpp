@@ -24,17 +24,44 @@ UPhysicsConstraintTemplate* IPhysicsAssetImporter::CreateNewConstraint(UPhysicsA
 	return NewConstraintSetup;
 }
 
+FJsonObject* IPhysicsAssetImporter::FindSubobjectExport(const TSharedPtr<FJsonObject>& Reference, const FName ExportName, TMap<FName, FExportData>& Exports) {
+	/* The object path ends with the index of the export */
+	FString StringIndex;
+	Reference->GetStringField(TEXT("ObjectPath")).Split(".", nullptr, &StringIndex, ESearchCase::IgnoreCase, ESearchDir::FromEnd);
+
+	const int32 Index = FCString::Atoi(*StringIndex);
+
+	if (AllJsonObjects.IsValidIndex(Index)) {
+		FJsonObject* Export = AllJsonObjects[Index]->AsObject().Get();
+		FString Name;
+
+		if (Export != nullptr && Export->TryGetStringField(TEXT("Name"), Name) && ExportName == FName(*Name)) {
+			return Export;
+		}
+	}
+
+	// Exports by name are only built when an index doesn't match
+	if (Exports.Num() == 0) {
+		Exports = CreateExports();
+	}
+
+	const FExportData* ExportData = Exports.Find(ExportName);
+	return ExportData != nullptr ? ExportData->Json : nullptr;
+}
+
 bool IPhysicsAssetImporter::Import()
 {
 	UPhysicsAsset* PhysicsAsset = NewObject<UPhysicsAsset>(Package, UPhysicsAsset::StaticClass(), *FileName, RF_Public | RF_Standalone);
 
 	TSharedPtr<FJsonObject> Properties = JsonObject->GetObjectField(TEXT("Properties"));
-	TMap<FName, FExportData> Exports = CreateExports();
+	TMap<FName, FExportData> Exports;
 	
 	/* SkeletalBodySetups ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 	ProcessJsonArrayField(Properties, TEXT("SkeletalBodySetups"), [&](const TSharedPtr<FJsonObject>& ObjectField) {
 		FName ExportName = GetExportNameOfSubobject(ObjectField->GetStringField(TEXT("ObjectName")));
-		FJsonObject* ExportJson = Exports.Find(ExportName)->Json;
+
+		FJsonObject* ExportJson = FindSubobjectExport(ObjectField, ExportName, Exports);
+		if (ExportJson == nullptr) return;
 
 		TSharedPtr<FJsonObject> ExportProperties = ExportJson->GetObjectField(TEXT("Properties"));
 		FName BoneName = FName(*ExportProperties->GetStringField(TEXT("BoneName")));
@@ -44,31 +71,34 @@ bool IPhysicsAssetImporter::Import()
 		GetObjectSerializer()->DeserializeObjectProperties(ExportProperties, BodySetup);
 	});
 
-	/* For caching. IMPORTANT! DO NOT REMOVE! */
-	PhysicsAsset->UpdateBodySetupIndexMap();
-	PhysicsAsset->UpdateBoundsBodiesArray();
-
 	/* CollisionDisableTable ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
-	TArray<TSharedPtr<FJsonValue>> CollisionDisableTable = JsonObject->GetArrayField(TEXT("CollisionDisableTable"));
+	const TArray<TSharedPtr<FJsonValue>>& CollisionDisableTable = JsonObject->GetArrayField(TEXT("CollisionDisableTable"));
+
+	/* Built at once, then moved into the asset */
+	TMap<FRigidBodyIndexPair, bool> DisableTable;
+	DisableTable.Reserve(CollisionDisableTable.Num());
 
-	for (const TSharedPtr<FJsonValue> TableJSONElement : CollisionDisableTable)
+	for (const TSharedPtr<FJsonValue>& TableJSONElement : CollisionDisableTable)
 	{
 		const TSharedPtr<FJsonObject> TableObjectElement = TableJSONElement->AsObject();
 
 		bool MapValue = TableObjectElement->GetBoolField(TEXT("Value"));
-		TArray<TSharedPtr<FJsonValue>> Indices = TableObjectElement->GetObjectField(TEXT("Key"))->GetArrayField(TEXT("Indices"));
+		const TArray<TSharedPtr<FJsonValue>>& Indices = TableObjectElement->GetObjectField(TEXT("Key"))->GetArrayField(TEXT("Indices"));
 
 		int32 BodyIndexA = Indices[0]->AsNumber();
 		int32 BodyIndexB = Indices[1]->AsNumber();
 
-		/* Add to the CollisionDisableTable */
-		PhysicsAsset->CollisionDisableTable.Add(FRigidBodyIndexPair(BodyIndexA, BodyIndexB), MapValue);
+		DisableTable.Add(FRigidBodyIndexPair(BodyIndexA, BodyIndexB), MapValue);
 	}
 
+	PhysicsAsset->CollisionDisableTable = MoveTemp(DisableTable);
+
 	/* ConstraintSetup ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 	ProcessJsonArrayField(Properties, TEXT("ConstraintSetup"), [&](const TSharedPtr<FJsonObject>& ObjectField) {
 		FName ExportName = GetExportNameOfSubobject(ObjectField->GetStringField(TEXT("ObjectName")));
-		FJsonObject* ExportJson = Exports.Find(ExportName)->Json;
+
+		FJsonObject* ExportJson = FindSubobjectExport(ObjectField, ExportName, Exports);
+		if (ExportJson == nullptr) return;
 
 		TSharedPtr<FJsonObject> ExportProperties = ExportJson->GetObjectField(TEXT("Properties"));
 		UPhysicsConstraintTemplate* PhysicsConstraintTemplate = CreateNewConstraint(PhysicsAsset, ExportName);
@@ -94,12 +124,13 @@ bool IPhysicsAssetImporter::Import()
 	if (SkeletalMesh)
 	{
 		PhysicsAsset->PreviewSkeletalMesh = SkeletalMesh;
-		PhysicsAsset->PostEditChange();
 	}
 	
-	/* Finalize ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
-	PhysicsAsset->Modify();
+	/* Finalize ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~ */
 	PhysicsAsset->MarkPackageDirty();
+
+	/* For caching, once every body is in. IMPORTANT! DO NOT REMOVE! */
+	PhysicsAsset->UpdateBodySetupIndexMap();
 	PhysicsAsset->UpdateBoundsBodiesArray();
 	
 	return OnAssetCreation(PhysicsAsset);
@@ -7,26 +7,24 @@
 #include "Engine/SkeletalMeshSocket.h"
 #include "Utilities/MathUtilities.h"
 
-bool CSkeletonAssetDerived::AddVirtualBone(const FName SourceBoneName, const FName TargetBoneName, const FName VirtualBoneRootName) {
-	for (const FVirtualBone& SSBone : VirtualBones) {
-		if (SSBone.SourceBoneName == SourceBoneName && SSBone.TargetBoneName == TargetBoneName) {
-			return false;
-		}
+void CSkeletonAssetDerived::AddVirtualBones(const TArray<FVirtualBone>& NewVirtualBones) {
+	if (NewVirtualBones.Num() == 0) {
+		return;
 	}
 
-	Modify();
-
-	FVirtualBone VirtualBone = FVirtualBone(SourceBoneName, TargetBoneName);
-	VirtualBone.VirtualBoneName = VirtualBoneRootName;
-
-	VirtualBones.Add(VirtualBone);
+	VirtualBones.Append(NewVirtualBones);
 
 	VirtualBoneGuid = FGuid::NewGuid();
 	check(VirtualBoneGuid.IsValid());
-
-	return true;
 }
 
+/* What happened to one kind of data merged into the skeleton */
+struct FSkeletonMergeCount {
+	int32 Added = 0;
+	int32 Replaced = 0;
+	int32 Skipped = 0;
+};
+
 bool ISkeletonImporter::Import() {
 	TSharedPtr<FJsonObject> Properties = JsonObject->GetObjectField(TEXT("Properties"));
 	USkeleton* Skeleton = GetSelectedAsset<USkeleton>();
@@ -36,6 +34,9 @@ bool ISkeletonImporter::Import() {
 
 	CSkeletonAssetDerived* SkeletonAsset = Cast<CSkeletonAssetDerived>(Skeleton);
 
+	// One transaction record for the whole merge
+	Skeleton->Modify();
+
 	const TArray<TSharedPtr<FJsonValue>>& BoneTree = Properties->GetArrayField(TEXT("BoneTree"));
 
 	for (int i = 0; i < BoneTree.Num(); i++) {
@@ -63,29 +64,87 @@ bool ISkeletonImporter::Import() {
 		Skeleton->SetBoneTranslationRetargetingMode(i, static_cast<EBoneTranslationRetargetingMode::Type>(EnumValue), false);
 	}
 
-	for (const TSharedPtr<FJsonValue> SlotGroupValue : Properties->GetArrayField(TEXT("SlotGroups"))) {
+	// Slots already in their group are left alone, slots in another group are moved
+	FSkeletonMergeCount Slots;
+
+	for (const TSharedPtr<FJsonValue>& SlotGroupValue : Properties->GetArrayField(TEXT("SlotGroups"))) {
 		const TSharedPtr<FJsonObject> SlotGroupObject = SlotGroupValue->AsObject();
 
-		FString GroupName = SlotGroupObject->GetStringField(TEXT("GroupName"));
-		TArray<TSharedPtr<FJsonValue>> SlotNamesArray = SlotGroupObject->GetArrayField(TEXT("SlotNames"));
+		const FName GroupName(*SlotGroupObject->GetStringField(TEXT("GroupName")));
+
+		for (const TSharedPtr<FJsonValue>& SlotNameValue : SlotGroupObject->GetArrayField(TEXT("SlotNames"))) {
+			const FName SlotName(*SlotNameValue->AsString());
+
+			if (!Skeleton->ContainsSlotName(SlotName)) {
+				Slots.Added++;
+			} else if (Skeleton->GetSlotGroupName(SlotName) != GroupName) {
+				Slots.Replaced++;
+			} else {
+				Slots.Skipped++;
+				continue;
+			}
 
-		for (const TSharedPtr<FJsonValue> SlotName : SlotNamesArray) {
-			Skeleton->Modify();
-			Skeleton->SetSlotGroupName(FName(*SlotName->AsString()), FName(*GroupName));
+			Skeleton->SetSlotGroupName(SlotName, GroupName);
 		}
 	}
 
-	for (const TSharedPtr<FJsonValue> VirtualBoneValue : Properties->GetArrayField(TEXT("VirtualBones"))) {
+	// Virtual bones are matched by their source and target bones
+	FSkeletonMergeCount VirtualBones;
+
+	TSet<TPair<FName, FName>> ExistingVirtualBones;
+	ExistingVirtualBones.Reserve(Skeleton->GetVirtualBones().Num());
+
+	for (const FVirtualBone& ExistingVirtualBone : Skeleton->GetVirtualBones()) {
+		ExistingVirtualBones.Add(TPair<FName, FName>(ExistingVirtualBone.SourceBoneName, ExistingVirtualBone.TargetBoneName));
+	}
+
+	TArray<FVirtualBone> NewVirtualBones;
+
+	for (const TSharedPtr<FJsonValue>& VirtualBoneValue : Properties->GetArrayField(TEXT("VirtualBones"))) {
 		const TSharedPtr<FJsonObject> VirtualBoneObject = VirtualBoneValue->AsObject();
 
-		const FString SourceBone = VirtualBoneObject->GetStringField(TEXT("SourceBoneName"));
-		const FString TargetBone = VirtualBoneObject->GetStringField(TEXT("TargetBoneName"));
-		const FString VirtualBone = VirtualBoneObject->GetStringField(TEXT("VirtualBoneName"));
+		const FName SourceBone(*VirtualBoneObject->GetStringField(TEXT("SourceBoneName")));
+		const FName TargetBone(*VirtualBoneObject->GetStringField(TEXT("TargetBoneName")));
+
+		bool bIsAlreadyCreated = false;
+		ExistingVirtualBones.Add(TPair<FName, FName>(SourceBone, TargetBone), &bIsAlreadyCreated);
+
+		if (bIsAlreadyCreated) {
+			VirtualBones.Skipped++;
+			continue;
+		}
+
+		FVirtualBone& VirtualBone = NewVirtualBones.Add_GetRef(FVirtualBone(SourceBone, TargetBone));
+		VirtualBone.VirtualBoneName = FName(*VirtualBoneObject->GetStringField(TEXT("VirtualBoneName")));
+
+		VirtualBones.Added++;
+	}
+
+	SkeletonAsset->AddVirtualBones(NewVirtualBones);
+
+	// Blend profiles and sockets already on the skeleton are updated in place when the export differs, like slots
+	FSkeletonMergeCount BlendProfiles;
+	FSkeletonMergeCount Sockets;
+
+	TMap<FName, UBlendProfile*> ExistingBlendProfiles;
+	ExistingBlendProfiles.Reserve(Skeleton->BlendProfiles.Num());
+
+	for (UBlendProfile* ExistingBlendProfile : Skeleton->BlendProfiles) {
+		if (ExistingBlendProfile != nullptr) {
+			ExistingBlendProfiles.Add(ExistingBlendProfile->GetFName(), ExistingBlendProfile);
+		}
+	}
 
-		SkeletonAsset->AddVirtualBone(FName(*SourceBone), FName(*TargetBone), FName(*VirtualBone));
+	TMap<FName, USkeletalMeshSocket*> ExistingSockets;
+	ExistingSockets.Reserve(Skeleton->Sockets.Num());
+
+	for (USkeletalMeshSocket* ExistingSocket : Skeleton->Sockets) {
+		if (ExistingSocket != nullptr) {
+			ExistingSockets.Add(ExistingSocket->SocketName, ExistingSocket);
+		}
 	}
 
-	for (const TSharedPtr<FJsonValue> SecondaryPurposeValueObject : AllJsonObjects) {
+	for (const TSharedPtr<FJsonValue>& SecondaryPurposeValueObject : AllJsonObjects) {
 		const TSharedPtr<FJsonObject> SecondaryPurposeObject = SecondaryPurposeValueObject->AsObject();
 
 		FString SecondaryPurposeType = SecondaryPurposeObject->GetStringField(TEXT("Type"));
@@ -93,70 +152,108 @@ bool ISkeletonImporter::Import() {
 
 		if (SecondaryPurposeType == "BlendProfile") {
 			const TSharedPtr<FJsonObject> SecondaryPurposeProperties = SecondaryPurposeObject->GetObjectField(TEXT("Properties"));
-			bool bIsAlreadyCreated = false;
 
-			for (const UBlendProfile* BlendProfileC : Skeleton->BlendProfiles) {
-				if (!bIsAlreadyCreated) {
-					bIsAlreadyCreated = BlendProfileC->GetFName() == FName(*SecondaryPurposeName);
-				}
-			}
+			UBlendProfile* BlendProfile = ExistingBlendProfiles.FindRef(FName(*SecondaryPurposeName));
+			const bool bIsAlreadyCreated = BlendProfile != nullptr;
 
 			if (!bIsAlreadyCreated) {
-				Skeleton->Modify();
-
-				UBlendProfile* BlendProfile = NewObject<UBlendProfile>(Skeleton, *SecondaryPurposeName, RF_Public | RF_Transactional);
+				BlendProfile = NewObject<UBlendProfile>(Skeleton, *SecondaryPurposeName, RF_Public | RF_Transactional);
 				Skeleton->BlendProfiles.Add(BlendProfile);
 
-				for (const TSharedPtr<FJsonValue> ProfileEntryValue : SecondaryPurposeProperties->GetArrayField(TEXT("ProfileEntries"))) {
-					const TSharedPtr<FJsonObject> ProfileEntry = ProfileEntryValue->AsObject();
+				ExistingBlendProfiles.Add(FName(*SecondaryPurposeName), BlendProfile);
+			}
 
-					Skeleton->Modify();
+			// An existing profile is replaced when any of its bone scales differs
+			bool bIsChanged = false;
 
 #if ENGINE_MAJOR_VERSION < 5
-					BlendProfile->SetBoneBlendScale(FName(*ProfileEntry->GetObjectField(TEXT("BoneReference"))->GetStringField(TEXT("BoneName"))), ProfileEntry->GetNumberField(TEXT("BlendScale")), false, true);
-#endif
+			for (const TSharedPtr<FJsonValue>& ProfileEntryValue : SecondaryPurposeProperties->GetArrayField(TEXT("ProfileEntries"))) {
+				const TSharedPtr<FJsonObject> ProfileEntry = ProfileEntryValue->AsObject();
+
+				const FName BoneName(*ProfileEntry->GetObjectField(TEXT("BoneReference"))->GetStringField(TEXT("BoneName")));
+				const float BlendScale = ProfileEntry->GetNumberField(TEXT("BlendScale"));
+
+				if (bIsAlreadyCreated && FMath::IsNearlyEqual(BlendProfile->GetBoneBlendScale(BoneName), BlendScale)) {
+					continue;
 				}
+
+				if (bIsAlreadyCreated && !bIsChanged) {
+					BlendProfile->Modify();
+				}
+
+				bIsChanged = true;
+				BlendProfile->SetBoneBlendScale(BoneName, BlendScale, false, true);
+			}
+#endif
+
+			if (!bIsAlreadyCreated) {
+				BlendProfiles.Added++;
+			} else if (bIsChanged) {
+				BlendProfiles.Replaced++;
+			} else {
+				BlendProfiles.Skipped++;
 			}
 		}
 
 		if (SecondaryPurposeType == "SkeletalMeshSocket") {
 			TSharedPtr<FJsonObject> SecondaryPurposeProperties = SecondaryPurposeObject->GetObjectField(TEXT("Properties"));
 
-			FString SocketName = SecondaryPurposeProperties->GetStringField(TEXT("SocketName"));
-			FString BoneName = SecondaryPurposeProperties->GetStringField(TEXT("BoneName"));
+			const FName SocketName(*SecondaryPurposeProperties->GetStringField(TEXT("SocketName")));
 
-			USkeletalMeshSocket* Socket = NewObject<USkeletalMeshSocket>(Skeleton);
-			Socket->SocketName = FName(*SocketName);
-			Socket->BoneName = FName(*BoneName);
+			USkeletalMeshSocket* Socket = ExistingSockets.FindRef(SocketName);
 
-			bool bIsAlreadyCreated = false;
+			// Fields missing from the export keep the value of the existing socket, or the default of a new one
+			const USkeletalMeshSocket* Current = Socket != nullptr ? Socket : GetDefault<USkeletalMeshSocket>();
 
-			for (USkeletalMeshSocket* SocketO : Skeleton->Sockets) {
-				if (!bIsAlreadyCreated) {
-					bIsAlreadyCreated = SocketO->SocketName == FName(*SecondaryPurposeName);
-				}
-			}
+			const FName BoneName(*SecondaryPurposeProperties->GetStringField(TEXT("BoneName")));
+			FRotator RelativeRotation = Current->RelativeRotation;
+			FVector RelativeLocation = Current->RelativeLocation;
+			FVector RelativeScale = Current->RelativeScale;
+			bool bForceAlwaysAnimated = Current->bForceAlwaysAnimated;
+
+			const TSharedPtr<FJsonObject>* RelativeLocationObjectVector;
+			const TSharedPtr<FJsonObject>* RelativeScaleObjectVector;
+			const TSharedPtr<FJsonObject>* RelativeRotationObjectRotator;
+			if (SecondaryPurposeProperties->TryGetObjectField(TEXT("RelativeRotation"), RelativeRotationObjectRotator) == true)
+				RelativeRotation = FMathUtilities::ObjectToRotator(RelativeRotationObjectRotator->Get());
+			if (SecondaryPurposeProperties->TryGetObjectField(TEXT("RelativeLocation"), RelativeLocationObjectVector) == true)
+				RelativeLocation = FMathUtilities::ObjectToVector(RelativeLocationObjectVector->Get());
+			if (SecondaryPurposeProperties->TryGetObjectField(TEXT("RelativeScale"), RelativeScaleObjectVector) == true)
+				RelativeScale = FMathUtilities::ObjectToVector(RelativeScaleObjectVector->Get());
+
+			SecondaryPurposeProperties->TryGetBoolField(TEXT("bForceAlwaysAnimated"), bForceAlwaysAnimated);
+
+			if (Socket == nullptr) {
+				Socket = NewObject<USkeletalMeshSocket>(Skeleton);
+				Socket->SocketName = SocketName;
 
-			if (!bIsAlreadyCreated) {
-				const TSharedPtr<FJsonObject>* RelativeLocationObjectVector;
-				const TSharedPtr<FJsonObject>* RelativeScaleObjectVector;
-				const TSharedPtr<FJsonObject>* RelativeRotationObjectRotator;
-				if (SecondaryPurposeProperties->TryGetObjectField(TEXT("RelativeRotation"), RelativeRotationObjectRotator) == true)
-					Socket->RelativeRotation = FMathUtilities::ObjectToRotator(RelativeRotationObjectRotator->Get());
-				if (SecondaryPurposeProperties->TryGetObjectField(TEXT("RelativeLocation"), RelativeLocationObjectVector) == true)
-					Socket->RelativeLocation = FMathUtilities::ObjectToVector(RelativeLocationObjectVector->Get());
-				if (SecondaryPurposeProperties->TryGetObjectField(TEXT("RelativeScale"), RelativeScaleObjectVector) == true)
-					Socket->RelativeScale = FMathUtilities::ObjectToVector(RelativeScaleObjectVector->Get());
-
-				bool bForceAlwaysAnimated;
-				if (SecondaryPurposeProperties->TryGetBoolField(TEXT("RelativeScale"), bForceAlwaysAnimated) == true)
-					Socket->bForceAlwaysAnimated = bForceAlwaysAnimated;
-
-				Skeleton->Modify();
 				Skeleton->Sockets.Add(Socket);
+				ExistingSockets.Add(SocketName, Socket);
+
+				Sockets.Added++;
+			} else if (Socket->BoneName == BoneName && Socket->RelativeRotation.Equals(RelativeRotation) && Socket->RelativeLocation.Equals(RelativeLocation) &&
+				Socket->RelativeScale.Equals(RelativeScale) && Socket->bForceAlwaysAnimated == bForceAlwaysAnimated) {
+				Sockets.Skipped++;
+				continue;
+			} else {
+				Socket->Modify();
+				Sockets.Replaced++;
 			}
+
+			Socket->BoneName = BoneName;
+			Socket->RelativeRotation = RelativeRotation;
+			Socket->RelativeLocation = RelativeLocation;
+			Socket->RelativeScale = RelativeScale;
+			Socket->bForceAlwaysAnimated = bForceAlwaysAnimated;
 		}
 	}
 
+	UE_LOG(LogJson, Log, TEXT("Merged %s into %s:"), *FileName, *Skeleton->GetName());
+
+	UE_LOG(LogJson, Log, TEXT("  Sockets: %d added, %d replaced, %d skipped"), Sockets.Added, Sockets.Replaced, Sockets.Skipped);
+	UE_LOG(LogJson, Log, TEXT("  Virtual bones: %d added, %d skipped"), VirtualBones.Added, VirtualBones.Skipped);
+	UE_LOG(LogJson, Log, TEXT("  Slots: %d added, %d moved to another group, %d skipped"), Slots.Added, Slots.Replaced, Slots.Skipped);
+	UE_LOG(LogJson, Log, TEXT("  Blend profiles: %d added, %d replaced, %d skipped"), BlendProfiles.Added, BlendProfiles.Replaced, BlendProfiles.Skipped);
+
 	return true;
 }
@@ -2,6 +2,7 @@
 
 #include "Importers/Types/Tables/CurveTableImporter.h"
 #include "Dom/JsonObject.h"
+#include "Algo/StableSort.h"
 
 // Unfortunately these variables are private, so we had to make a "bypass" by making
 // an asset then casting to subclass that has these functions to modify them.
@@ -13,6 +14,22 @@ void CCurveTableDerived::ChangeTableMode(ECurveTableMode Mode) {
 	CurveTableMode = Mode;
 }
 
+/* Enum values by name, looked up once per table instead of once per key */
+template <typename TEnum>
+class TEnumNameCache {
+public:
+	TEnum Get(const FString& Name) {
+		if (const TEnum* Value = Values.Find(Name)) {
+			return *Value;
+		}
+
+		return Values.Add(Name, static_cast<TEnum>(StaticEnum<TEnum>()->GetValueByNameString(Name)));
+	}
+
+private:
+	TMap<FString, TEnum> Values;
+};
+
 bool ICurveTableImporter::Import() {
 	TSharedPtr<FJsonObject> RowData = JsonObject->GetObjectField(TEXT("Rows"));
 	UCurveTable* CurveTable = NewObject<UCurveTable>(Package, UCurveTable::StaticClass(), *FileName, RF_Public | RF_Standalone);
@@ -28,81 +45,80 @@ bool ICurveTableImporter::Import() {
 		DerivedCurveTable->ChangeTableMode(CurveTableMode);
 	}
 
+	TEnumNameCache<ERichCurveInterpMode> InterpModes;
+	TEnumNameCache<ERichCurveTangentMode> TangentModes;
+	TEnumNameCache<ERichCurveTangentWeightMode> TangentWeightModes;
+	TEnumNameCache<ERichCurveExtrapolation> Extrapolations;
+
+	// Every row is added in one pass, the table is modified and broadcast once
+	CurveTable->Modify(true);
+
 	// Loop throughout row data, and deserialize
 	for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : RowData->Values) {
 		const TSharedPtr<FJsonObject> CurveData = Pair.Value->AsObject();
 
-		// Curve structure (either simple or rich)
-		FRealCurve RealCurve;
+		const TArray<TSharedPtr<FJsonValue>>* KeysPtr = nullptr;
+		CurveData->TryGetArrayField(TEXT("Keys"), KeysPtr);
+
+		const int32 NumKeys = KeysPtr != nullptr ? KeysPtr->Num() : 0;
+
+		// Curve structure (either simple or rich), filled in place
+		FRealCurve* RealCurve;
 
 		if (CurveTableMode == ECurveTableMode::RichCurves) {
-			FRichCurve& NewRichCurve = CurveTable->AddRichCurve(FName(*Pair.Key)); {
-				RealCurve = NewRichCurve;
+			FRichCurve& NewRichCurve = CurveTable->AddRichCurve(FName(*Pair.Key));
+			RealCurve = &NewRichCurve;
+
+			TArray<FRichCurveKey> Keys;
+			Keys.Reserve(NumKeys);
+
+			for (int32 KeyIndex = 0; KeyIndex < NumKeys; KeyIndex++) {
+				const TSharedPtr<FJsonObject> Key = (*KeysPtr)[KeyIndex]->AsObject();
+
+				FRichCurveKey& RichKey = Keys.Emplace_GetRef(Key->GetNumberField(TEXT("Time")), Key->GetNumberField(TEXT("Value")));
+
+				RichKey.InterpMode = InterpModes.Get(Key->GetStringField(TEXT("InterpMode")));
+				RichKey.TangentMode = TangentModes.Get(Key->GetStringField(TEXT("TangentMode")));
+				RichKey.TangentWeightMode = TangentWeightModes.Get(Key->GetStringField(TEXT("TangentWeightMode")));
+
+				RichKey.ArriveTangent = Key->GetNumberField(TEXT("ArriveTangent"));
+				RichKey.ArriveTangentWeight = Key->GetNumberField(TEXT("ArriveTangentWeight"));
+				RichKey.LeaveTangent = Key->GetNumberField(TEXT("LeaveTangent"));
+				RichKey.LeaveTangentWeight = Key->GetNumberField(TEXT("LeaveTangentWeight"));
 			}
 
-			const TArray<TSharedPtr<FJsonValue>>* KeysPtr;
-			if (CurveData->TryGetArrayField(TEXT("Keys"), KeysPtr))
-				for (const TSharedPtr<FJsonValue> KeyPtr : *KeysPtr) {
-					TSharedPtr<FJsonObject> Key = KeyPtr->AsObject(); {
-						NewRichCurve.AddKey(Key->GetNumberField(TEXT("Time")), Key->GetNumberField(TEXT("Value")));
-						FRichCurveKey RichKey = NewRichCurve.Keys.Last();
-
-						RichKey.InterpMode =
-							static_cast<ERichCurveInterpMode>(
-								StaticEnum<ERichCurveInterpMode>()->GetValueByNameString(Key->GetStringField(TEXT("InterpMode")))
-							);
-						RichKey.TangentMode =
-							static_cast<ERichCurveTangentMode>(
-								StaticEnum<ERichCurveTangentMode>()->GetValueByNameString(Key->GetStringField(TEXT("TangentMode")))
-							);
-						RichKey.TangentWeightMode =
-							static_cast<ERichCurveTangentWeightMode>(
-								StaticEnum<ERichCurveTangentWeightMode>()->GetValueByNameString(Key->GetStringField(TEXT("TangentWeightMode")))
-							);
-
-						RichKey.ArriveTangent = Key->GetNumberField(TEXT("ArriveTangent"));
-						RichKey.ArriveTangentWeight = Key->GetNumberField(TEXT("ArriveTangentWeight"));
-						RichKey.LeaveTangent = Key->GetNumberField(TEXT("LeaveTangent"));
-						RichKey.LeaveTangentWeight = Key->GetNumberField(TEXT("LeaveTangentWeight"));
-					}
-				}
+			// Keys are exported in time order, AddKey would have kept them sorted
+			Algo::StableSortBy(Keys, &FRichCurveKey::Time);
+			NewRichCurve.Keys = MoveTemp(Keys);
 		} else {
-			FSimpleCurve& NewSimpleCurve = CurveTable->AddSimpleCurve(FName(*Pair.Key)); {
-				RealCurve = NewSimpleCurve;
-			}
+			FSimpleCurve& NewSimpleCurve = CurveTable->AddSimpleCurve(FName(*Pair.Key));
+			RealCurve = &NewSimpleCurve;
 
 			// Method of Interpolation
-			NewSimpleCurve.InterpMode =
-				static_cast<ERichCurveInterpMode>(
-					StaticEnum<ERichCurveInterpMode>()->GetValueByNameString(CurveData->GetStringField(TEXT("InterpMode")))
-				);
-
-			const TArray<TSharedPtr<FJsonValue>>* KeysPtr;
-			
-			if (CurveData->TryGetArrayField(TEXT("Keys"), KeysPtr))
-				for (const TSharedPtr<FJsonValue> KeyPtr : *KeysPtr) {
-					TSharedPtr<FJsonObject> Key = KeyPtr->AsObject(); {
-						NewSimpleCurve.AddKey(Key->GetNumberField(TEXT("Time")), Key->GetNumberField(TEXT("Value")));
-					}
-				}
+			NewSimpleCurve.InterpMode = InterpModes.Get(CurveData->GetStringField(TEXT("InterpMode")));
+
+			TArray<FSimpleCurveKey> Keys;
+			Keys.Reserve(NumKeys);
+
+			for (int32 KeyIndex = 0; KeyIndex < NumKeys; KeyIndex++) {
+				const TSharedPtr<FJsonObject> Key = (*KeysPtr)[KeyIndex]->AsObject();
+
+				Keys.Emplace(Key->GetNumberField(TEXT("Time")), Key->GetNumberField(TEXT("Value")));
+			}
+
+			Algo::StableSortBy(Keys, &FSimpleCurveKey::Time);
+			NewSimpleCurve.Keys = MoveTemp(Keys);
 		}
 
 		// Inherited data from FRealCurve
-		RealCurve.SetDefaultValue(CurveData->GetNumberField(TEXT("DefaultValue")));
-		RealCurve.PreInfinityExtrap = 
-			static_cast<ERichCurveExtrapolation>(
-				StaticEnum<ERichCurveExtrapolation>()->GetValueByNameString(CurveData->GetStringField(TEXT("PreInfinityExtrap")))
-			);
-		RealCurve.PostInfinityExtrap =
-			static_cast<ERichCurveExtrapolation>(
-				StaticEnum<ERichCurveExtrapolation>()->GetValueByNameString(CurveData->GetStringField(TEXT("PostInfinityExtrap")))
-			);
-
-		// Update Curve Table
-		CurveTable->OnCurveTableChanged().Broadcast();
-		CurveTable->Modify(true);
+		RealCurve->SetDefaultValue(CurveData->GetNumberField(TEXT("DefaultValue")));
+		RealCurve->PreInfinityExtrap = Extrapolations.Get(CurveData->GetStringField(TEXT("PreInfinityExtrap")));
+		RealCurve->PostInfinityExtrap = Extrapolations.Get(CurveData->GetStringField(TEXT("PostInfinityExtrap")));
 	}
 
+	// Update Curve Table
+	CurveTable->OnCurveTableChanged().Broadcast();
+
 	// Handle edit changes, and add it to the content browser
 	return OnAssetCreation(CurveTable);
-}
\ No newline at end of file
+}
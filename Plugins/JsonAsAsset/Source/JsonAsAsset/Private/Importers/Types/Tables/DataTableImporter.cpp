@@ -2,6 +2,72 @@
 
 #include "Importers/Types/Tables/DataTableImporter.h"
 #include "Dom/JsonObject.h"
+#include "Async/ParallelFor.h"
+#include "Dom/JsonValue.h"
+#include "Utilities/JsonStreamUtilities.h"
+
+/* Rows decoded at once while streaming, the Json of older rows is already released */
+static constexpr int32 RowStreamBatchSize = 1024;
+
+void CDataTableDerived::AddRows(const TArray<FName>& Names, TArray<uint8*>& Rows) {
+	RowMap.Reserve(RowMap.Num() + Rows.Num());
+
+	for (int32 Index = 0; Index < Rows.Num(); Index++) {
+		// Same as AddRow, a row with the same name is replaced
+		if (uint8** Existing = RowMap.Find(Names[Index])) {
+			RowStruct->DestroyStruct(*Existing);
+			FMemory::Free(*Existing);
+		}
+
+		RowMap.Add(Names[Index], Rows[Index]);
+		Rows[Index] = nullptr;
+	}
+
+	HandleDataTableChanged();
+}
+
+/* Row memory decoded ahead of the table, freed here unless the table took it */
+struct FStagedDataTableRows {
+	UScriptStruct* RowStruct = nullptr;
+
+	TArray<FName> Names;
+	TArray<TSharedPtr<FJsonObject>> Values;
+	TArray<uint8*> Rows;
+
+	~FStagedDataTableRows() {
+		for (uint8* Row : Rows) {
+			if (Row == nullptr) continue;
+
+			RowStruct->DestroyStruct(Row);
+			FMemory::Free(Row);
+		}
+	}
+};
+
+/* Decodes the staged rows into row memory, then hands them to the table at once */
+static void AddStagedRows(UDataTable* DataTable, UPropertySerializer* PropertySerializer, FStagedDataTableRows& Staged) {
+	UScriptStruct* TableRowStruct = Staged.RowStruct;
+	Staged.Rows.SetNumZeroed(Staged.Values.Num());
+
+	// Rows are decoded straight into the memory the table keeps, on workers when
+	// nothing in the row struct loads or imports assets
+	const bool bSingleThreaded = !CanReadJsonOffGameThread() || !PropertySerializer->CanDeserializeOffGameThread(TableRowStruct);
+
+	ParallelFor(Staged.Rows.Num(), [&Staged, PropertySerializer, TableRowStruct](const int32 Index) {
+		uint8* Row = static_cast<uint8*>(FMemory::Malloc(TableRowStruct->GetStructureSize()));
+		TableRowStruct->InitializeStruct(Row);
+
+		Staged.Rows[Index] = Row;
+
+		PropertySerializer->DeserializeStruct(TableRowStruct, Staged.Values[Index].ToSharedRef(), Row);
+	}, bSingleThreaded);
+
+	Cast<CDataTableDerived>(DataTable)->AddRows(Staged.Names, Staged.Rows);
+
+	Staged.Names.Reset();
+	Staged.Values.Reset();
+	Staged.Rows.Reset();
+}
 
 // Shout-out to UEAssetToolkit
 bool IDataTableImporter::Import() {
@@ -31,18 +97,150 @@ bool IDataTableImporter::Import() {
 
 	// Access Property Serializer
 	UPropertySerializer* ObjectPropertySerializer = GetObjectSerializer()->GetPropertySerializer();
-	TSharedPtr<FJsonObject> RowData = JsonObject->GetObjectField(TEXT("Rows"));
 
-	// Loop throughout row data, and deserialize
-	for (TPair<FString, TSharedPtr<FJsonValue>>& Pair : RowData->Values) {
-		TSharedPtr<FStructOnScope> ScopedStruct = MakeShareable(new FStructOnScope(TableRowStruct));
-		TSharedPtr<FJsonObject> StructData = Pair.Value->AsObject();
+	// Rows are read from the file while importing
+	if (RowStream.IsValid() && !JsonObject->HasField(TEXT("Rows"))) {
+		if (!ReadRowStream(DataTable, TableRowStruct)) {
+			return false;
+		}
+	} else {
+		TSharedPtr<FJsonObject> RowData = JsonObject->GetObjectField(TEXT("Rows"));
+
+		FStagedDataTableRows Staged;
+		Staged.RowStruct = TableRowStruct;
+
+		Staged.Names.Reserve(RowData->Values.Num());
+		Staged.Values.Reserve(RowData->Values.Num());
 
-		// Deserialize, add row
-		ObjectPropertySerializer->DeserializeStruct(TableRowStruct, StructData.ToSharedRef(), ScopedStruct->GetStructMemory());
-		DataTable->AddRow(*Pair.Key, *(const FTableRowBase*)ScopedStruct->GetStructMemory());
+		for (TPair<FString, TSharedPtr<FJsonValue>>& Pair : RowData->Values) {
+			Staged.Names.Add(*Pair.Key);
+			Staged.Values.Add(Pair.Value->AsObject());
+		}
+
+		// Hand every row to the table at once
+		AddStagedRows(DataTable, ObjectPropertySerializer, Staged);
 	}
 
 	// Handle edit changes, and add it to the content browser
 	return OnAssetCreation(DataTable);
 }
+
+bool IDataTableImporter::ReadRowStream(UDataTable* DataTable, UScriptStruct* TableRowStruct) const {
+	UPropertySerializer* ObjectPropertySerializer = GetObjectSerializer()->GetPropertySerializer();
+
+	FStagedDataTableRows Staged;
+	Staged.RowStruct = TableRowStruct;
+
+	Staged.Names.Reserve(RowStreamBatchSize);
+	Staged.Values.Reserve(RowStreamBatchSize);
+
+	int32 NumRows = 0;
+
+	TJsonReader<TCHAR>& Reader = *RowStream->Reader;
+
+	EJsonNotation Notation = EJsonNotation::Error;
+	while (Reader.ReadNext(Notation) && Notation != EJsonNotation::ObjectEnd) {
+		const FString RowName = Reader.GetIdentifier();
+		const TSharedPtr<FJsonValue> Row = FJsonStreamUtilities::ReadValue(Reader, Notation);
+		if (!Row.IsValid()) break;
+
+		if (Row->Type != EJson::Object) {
+			UE_LOG(LogJson, Warning, TEXT("Skipped row %s of %s, it isn't an object"), *RowName, *FileName);
+			continue;
+		}
+
+		Staged.Names.Add(*RowName);
+		Staged.Values.Add(Row->AsObject());
+		NumRows++;
+
+		// Decoded rows release their Json
+		if (Staged.Values.Num() == RowStreamBatchSize) {
+			AddStagedRows(DataTable, ObjectPropertySerializer, Staged);
+		}
+	}
+
+	if (Notation != EJsonNotation::ObjectEnd) {
+		UE_LOG(LogJson, Error, TEXT("Failed to read the rows of %s after %d rows: %s"), *FileName, NumRows, *Reader.GetErrorMessage());
+		AppendNotification(FText::FromString("DataTable Rows Unreadable"), FText::FromString(FileName), 2.0f, SNotificationItem::CS_Fail, true, 350.0f);
+
+		return false;
+	}
+
+	AddStagedRows(DataTable, ObjectPropertySerializer, Staged);
+	RowStream->bRowsRead = true;
+
+	UE_LOG(LogJson, Log, TEXT("Streamed %d rows into %s"), NumRows, *FileName);
+
+	return true;
+}
+
+bool IDataTableImporter::ImportStreamed(const FString& File) {
+	const TSharedPtr<FJsonFileReader> Reader = FJsonFileReader::Create(File);
+	if (!Reader.IsValid()) return false;
+
+	EJsonNotation Notation = EJsonNotation::Error;
+	if (!Reader->ReadNext(Notation) || Notation != EJsonNotation::ArrayStart) return false;
+	if (!Reader->ReadNext(Notation) || Notation != EJsonNotation::ObjectStart) return false;
+
+	// Everything of the export up to its rows
+	const TSharedPtr<FJsonObject> Export = MakeShared<FJsonObject>();
+
+	while (Reader->ReadNext(Notation) && Notation != EJsonNotation::ObjectEnd) {
+		const FString Identifier = Reader->GetIdentifier();
+
+		if (Identifier == "Rows" && Notation == EJsonNotation::ObjectStart) {
+			break;
+		}
+
+		const TSharedPtr<FJsonValue> Value = FJsonStreamUtilities::ReadValue(*Reader, Notation);
+		if (!Value.IsValid()) return false;
+
+		// Not a data table, nothing was imported yet
+		if (Identifier == "Type" && Value->AsString() != "DataTable") return false;
+
+		Export->SetField(Identifier, Value);
+	}
+
+	FString Type;
+	if (Notation != EJsonNotation::ObjectStart || !Export->TryGetStringField(TEXT("Type"), Type) || !Export->HasField(TEXT("Properties"))) {
+		return false;
+	}
+
+	TArray<TSharedPtr<FJsonValue>> Exports;
+	Exports.Add(MakeShared<FJsonValueObject>(Export));
+
+	// The reader is handed down to the importer of this table only, tables imported on demand while it runs read their own files
+	const TSharedPtr<FDataTableRowStream> RowStream = MakeShared<FDataTableRowStream>();
+	RowStream->Reader = Reader;
+
+	IImporter().ImportExports(Exports, File, false, RowStream);
+
+	// The table failed before reading all of its rows, the rest of them is skipped so the exports after it are still imported
+	if (!RowStream->bRowsRead) {
+		if (!FJsonStreamUtilities::SkipValue(*Reader, EJsonNotation::ObjectStart)) {
+			UE_LOG(LogJson, Error, TEXT("Failed to read %s past the rows of its data table: %s"), *File, *Reader->GetErrorMessage());
+			return true;
+		}
+	}
+
+	// Fields after the rows aren't used by the table
+	while (Reader->ReadNext(Notation) && Notation != EJsonNotation::ObjectEnd) {
+		if (!FJsonStreamUtilities::SkipValue(*Reader, Notation)) return true;
+	}
+
+	// Exports following the table are imported as usual
+	Exports.Reset();
+
+	while (Reader->ReadNext(Notation) && Notation != EJsonNotation::ArrayEnd) {
+		const TSharedPtr<FJsonValue> Value = FJsonStreamUtilities::ReadValue(*Reader, Notation);
+		if (!Value.IsValid()) break;
+
+		Exports.Add(Value);
+	}
+
+	if (Exports.Num() > 0) {
+		IImporter().ImportExports(Exports, File);
+	}
+
+	return true;
+}
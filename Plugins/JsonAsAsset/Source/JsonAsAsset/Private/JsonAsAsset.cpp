@@ -28,6 +28,14 @@
 #include "ISettingsModule.h"
 #include "MessageLogModule.h"
 #include "Styling/SlateIconFinder.h"
+#include "ContentBrowserModule.h"
+#include "IContentBrowserSingleton.h"
+#include "Utilities/AssetUtilities.h"
+#include "Utilities/MaterialCompileBatch.h"
+#include "Utilities/JsonStreamUtilities.h"
+#include "Utilities/AnimationCompressionBatch.h"
+#include "Utilities/Textures/TextureDecodeCache.h"
+#include "Importers/Constructor/Graph/MaterialFunctionImportPlanner.h"
 
 // Settings
 #include "./Settings/Details/JsonAsAssetSettingsDetails.h"
@@ -126,15 +134,47 @@ void FJsonAsAssetModule::PluginButtonClicked() {
 	if (OutFileNames.Num() == 0)
 		return;
 
+	// Decode cache hits and misses are reported for this batch only
+	FTextureDecodeCache::ResetCounters();
+
+	// Textures are imported together, only with Local Fetch: texture exports carry no
+	// pixel data, their payload is downloaded from Local Fetch, so without it texture
+	// files can't be imported at all
+	if (Settings->bEnableLocalFetch) {
+		ImportTextureFiles(OutFileNames);
+	}
+
+	// Materials from every selected file compile together once the loop is done,
+	// animations are compressed together on the async path and gameplay tags are
+	// looked up once for the whole batch
+	FMaterialCompileBatch MaterialCompileBatch;
+	FAnimationCompressionBatch AnimationCompressionBatch;
+	FGameplayTagCacheScope GameplayTagCacheScope;
+
+	// Material functions go first, leaves before the functions and materials calling them
+	TMap<FString, TArray<TSharedPtr<FJsonValue>>> ParsedFiles;
+	FMaterialFunctionImportPlanner::ImportFunctionsFirst(OutFileNames, ParsedFiles);
+
 	for (FString& File : OutFileNames) {
 		// Clear Message Log
 		FMessageLogModule& MessageLogModule = FModuleManager::GetModuleChecked<FMessageLogModule>("MessageLog");
 		TSharedRef<IMessageLogListing> LogListing = (MessageLogModule.GetLogListing("JsonAsAsset"));
 		LogListing->ClearMessages();
 
-		// Import asset by IImporter
+		// Import asset by IImporter, materials parsed by the planner aren't read again
 		IImporter* Importer = new IImporter();
-		Importer->ImportReference(File);
+
+		TArray<TSharedPtr<FJsonValue>> Exports;
+		if (ParsedFiles.RemoveAndCopyValue(File, Exports)) {
+			Importer->ImportExports(MoveTemp(Exports), File);
+		} else {
+			Importer->ImportReference(File);
+		}
+	}
+
+	if (FTextureDecodeCache::GetHits() + FTextureDecodeCache::GetMisses() > 0) {
+		UE_LOG(LogJson, Log, TEXT("Texture decode cache: %lld hits, %lld misses, %lld bytes cached"),
+			FTextureDecodeCache::GetHits(), FTextureDecodeCache::GetMisses(), FTextureDecodeCache::GetCachedBytes());
 	}
 }
 
@@ -654,6 +694,61 @@ void FJsonAsAssetModule::CreateLocalFetchDropdown(FMenuBuilder MenuBuilder) cons
 	MenuBuilder.EndSection();
 }
 
+void FJsonAsAssetModule::ImportTextureFiles(TArray<FString>& Files) const
+{
+	static const TArray<FString> TextureTypes = {
+		"Texture2D",
+		"TextureCube",
+		"VolumeTexture"
+	};
+
+	TArray<FString> TexturePaths;
+
+	Files.RemoveAll([&TexturePaths](const FString& File) {
+		/* Only the head of the first export is read, other files are parsed once by their importer */
+		FString Type, Name;
+		if (!FJsonStreamUtilities::ReadFirstExportHeader(File, Type, Name)) {
+			return false;
+		}
+
+		if (!TextureTypes.Contains(Type) || Name.IsEmpty()) {
+			return false;
+		}
+
+		/* Resolve the game path the same way other importers place their packages, the package itself is only created once decoded */
+		TexturePaths.Add(FAssetUtilities::GetAssetPackageName(Name, FPaths::ConvertRelativePathToFull(File)) + "." + Name);
+
+		return true;
+	});
+
+	if (TexturePaths.Num() == 0) {
+		return;
+	}
+
+	TArray<UTexture*> Textures;
+	const bool bSuccess = FAssetUtilities::Construct_TypeTextures(TexturePaths, Textures);
+
+	AppendNotification(
+		FText::FromString(FString::Printf(TEXT("Locally Downloaded: %d / %d Textures"), Textures.Num(), TexturePaths.Num())),
+		FText::FromString("Texture Batch"),
+		2.0f,
+		FSlateIconFinder::FindCustomIconBrushForClass(UTexture2D::StaticClass(), TEXT("ClassThumbnail")),
+		bSuccess ? SNotificationItem::CS_Success : SNotificationItem::CS_Fail,
+		false,
+		350.0f
+	);
+
+	if (Textures.Num() > 0) {
+		TArray<FAssetData> Assets;
+		for (UTexture* Texture : Textures) {
+			Assets.Add(FAssetData(Texture));
+		}
+
+		const FContentBrowserModule& ContentBrowserModule = FModuleManager::Get().LoadModuleChecked<FContentBrowserModule>("ContentBrowser");
+		ContentBrowserModule.Get().SyncBrowserToAssets(Assets);
+	}
+}
+
 void FJsonAsAssetModule::ImportConvexCollision() const
 {
 	TArray<FAssetData> AssetDataList = GetAssetsInSelectedFolder();
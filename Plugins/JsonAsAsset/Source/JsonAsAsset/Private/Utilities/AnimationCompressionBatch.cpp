@@ -0,0 +1,147 @@
+// Copyright JAA Contributors 2024-2025
+
+#include "Utilities/AnimationCompressionBatch.h"
+
+#include "Animation/AnimSequence.h"
+#include "Misc/ScopedSlowTask.h"
+#include "Interfaces/ITargetPlatform.h"
+#include "Interfaces/ITargetPlatformManagerModule.h"
+#include "Json.h"
+#include "Utilities/AssetUtilities.h"
+
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3
+#include "IO/IoHash.h"
+#endif
+
+#define LOCTEXT_NAMESPACE "JsonAsAsset"
+
+int32 FAnimationCompressionBatch::Depth = 0;
+
+TArray<TWeakObjectPtr<UAnimSequence>> FAnimationCompressionBatch::PendingSequences;
+TArray<TWeakObjectPtr<UPackage>> FAnimationCompressionBatch::PendingPackages;
+
+FAnimationCompressionBatch::FAnimationCompressionBatch() {
+	check(IsInGameThread());
+	Depth++;
+}
+
+FAnimationCompressionBatch::~FAnimationCompressionBatch() {
+	// Only the outermost scope compresses
+	if (--Depth == 0) {
+		Flush();
+	}
+}
+
+bool FAnimationCompressionBatch::IsActive() {
+	return Depth > 0;
+}
+
+bool FAnimationCompressionBatch::Defer(UAnimSequence* AnimSequence) {
+	if (!IsActive() || AnimSequence == nullptr) {
+		return false;
+	}
+
+	AnimSequence->MarkPackageDirty();
+	PendingSequences.AddUnique(AnimSequence);
+
+	return true;
+}
+
+bool FAnimationCompressionBatch::DeferSave(UPackage* Package) {
+	if (!IsActive() || Package == nullptr) {
+		return false;
+	}
+
+	TArray<UObject*> Objects;
+	GetObjectsWithOuter(Package, Objects, false);
+
+	for (const UObject* Object : Objects) {
+		if (Object->IsA<UAnimSequence>()) {
+			PendingPackages.AddUnique(Package);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void FAnimationCompressionBatch::Flush() {
+	if (PendingSequences.Num() == 0 && PendingPackages.Num() == 0) {
+		return;
+	}
+
+	/* Take the lists first, anything compressed below must not be deferred again */
+	TArray<UAnimSequence*> Sequences;
+	for (const TWeakObjectPtr<UAnimSequence>& AnimSequence : PendingSequences) {
+		if (AnimSequence.IsValid()) {
+			Sequences.Add(AnimSequence.Get());
+		}
+	}
+
+	const TArray<TWeakObjectPtr<UPackage>> Packages = MoveTemp(PendingPackages);
+	PendingSequences.Empty();
+
+	FScopedSlowTask SlowTask(Sequences.Num(), FText::Format(LOCTEXT("CompressingAnimations", "Compressing {0} animations"), FText::AsNumber(Sequences.Num())));
+	SlowTask.MakeDialog();
+
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 2
+	if (ITargetPlatform* RunningPlatform = GetTargetPlatformManagerRef().GetRunningTargetPlatform()) {
+		// Start every sequence, the derived data tasks spread over the worker threads.
+		// Since 5.3 a started task is finished through its derived data key
+#if ENGINE_MINOR_VERSION >= 3
+		TArray<FIoHash> KeyHashes;
+		KeyHashes.Reserve(Sequences.Num());
+
+		for (UAnimSequence* AnimSequence : Sequences) {
+			KeyHashes.Add(AnimSequence->BeginCacheDerivedData(RunningPlatform));
+		}
+#else
+		for (UAnimSequence* AnimSequence : Sequences) {
+			AnimSequence->BeginCacheDerivedData(RunningPlatform);
+		}
+#endif
+
+		// Then finish them in order, ending a task blocks until it is done while the rest keep running
+		for (int32 Index = 0; Index < Sequences.Num(); Index++) {
+			SlowTask.EnterProgressFrame(1);
+
+#if ENGINE_MINOR_VERSION >= 3
+			Sequences[Index]->EndCacheDerivedData(KeyHashes[Index]);
+#else
+			Sequences[Index]->EndCacheDerivedData(RunningPlatform);
+#endif
+		}
+	} else {
+		// No target platform to start tasks for, each sequence is compressed for the editor on its own
+		for (UAnimSequence* AnimSequence : Sequences) {
+			SlowTask.EnterProgressFrame(1);
+			AnimSequence->CacheDerivedDataForCurrentPlatform();
+		}
+	}
+#else
+	// Older engines compress on their async compression manager, every sequence is queued at once
+	for (UAnimSequence* AnimSequence : Sequences) {
+		AnimSequence->RequestAsyncAnimRecompression(false);
+	}
+
+	// Then waited for, so the packages below are saved compressed
+	for (UAnimSequence* AnimSequence : Sequences) {
+		SlowTask.EnterProgressFrame(1);
+		AnimSequence->WaitOnExistingCompression();
+	}
+#endif
+
+	UE_LOG(LogJson, Log, TEXT("Compressed animation batch: %d sequences"), Sequences.Num());
+
+	// Saved once compressed, like outside of a batch
+	TArray<UPackage*> PackagesToSave;
+	for (const TWeakObjectPtr<UPackage>& Package : Packages) {
+		if (Package.IsValid()) {
+			PackagesToSave.Add(Package.Get());
+		}
+	}
+
+	FAssetUtilities::SavePackages(PackagesToSave);
+}
+
+#undef LOCTEXT_NAMESPACE
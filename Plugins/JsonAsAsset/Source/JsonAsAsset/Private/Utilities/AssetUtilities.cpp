@@ -13,6 +13,7 @@
 #include "Dom/JsonObject.h"
 
 #include "UObject/SavePackage.h"
+#include "Async/ParallelFor.h"
 
 #include "HttpModule.h"
 #include "AssetRegistry/AssetRegistryModule.h"
@@ -38,6 +39,25 @@ UPackage* FAssetUtilities::CreateAssetPackage(const FString& Name, const FString
 }
 
 UPackage* FAssetUtilities::CreateAssetPackage(const FString& Name, const FString& OutputPath, UPackage*& OutOutermostPkg) {
+	const FString PathWithGame = GetAssetPackageName(Name, OutputPath);
+
+	// Missing Plugin: Create it
+	FString RootName; {
+		PathWithGame.Split("/", nullptr, &RootName, ESearchCase::IgnoreCase, ESearchDir::FromStart);
+		RootName.Split("/", &RootName, nullptr, ESearchCase::IgnoreCase, ESearchDir::FromStart);
+	}
+
+	if (RootName != "Game" && RootName != "Engine" && IPluginManager::Get().FindPlugin(RootName) == nullptr)
+		CreatePlugin(RootName);
+
+	UPackage* Package = CreatePackage(*PathWithGame);
+	OutOutermostPkg = Package->GetOutermost();
+	Package->FullyLoad();
+
+	return Package;
+}
+
+FString FAssetUtilities::GetAssetPackageName(const FString& Name, const FString& OutputPath) {
 	const UJsonAsAssetSettings* Settings = GetDefault<UJsonAsAssetSettings>();
 	FString ModifiablePath;
 
@@ -69,38 +89,15 @@ UPackage* FAssetUtilities::CreateAssetPackage(const FString& Name, const FString
 		}
 
 		ModifiablePath = "/" + ModifiablePath + "/";
-
-		// Check if plugin exists
-		if (bIsPlugin) {
-			FString PluginName;
-			ModifiablePath.Split("/", nullptr, &PluginName, ESearchCase::IgnoreCase, ESearchDir::FromStart);
-			PluginName.Split("/", &PluginName, nullptr, ESearchCase::IgnoreCase, ESearchDir::FromStart);
-
-			if (IPluginManager::Get().FindPlugin(PluginName) == nullptr)
-				CreatePlugin(PluginName);
-		}
 	}
 	else {
-		FString RootName; {
-			OutputPath.Split("/", nullptr, &RootName, ESearchCase::IgnoreCase, ESearchDir::FromStart);
-			RootName.Split("/", &RootName, nullptr, ESearchCase::IgnoreCase, ESearchDir::FromStart);
-		}
-
-		if (RootName != "Game" && RootName != "Engine" && IPluginManager::Get().FindPlugin(RootName) == nullptr)
-			CreatePlugin(RootName);
-
 		ModifiablePath = OutputPath;
 		ModifiablePath.Split("/", &ModifiablePath, nullptr, ESearchCase::IgnoreCase, ESearchDir::FromEnd);
 
 		ModifiablePath = ModifiablePath + "/";
 	}
 
-	const FString PathWithGame = ModifiablePath + Name;
-	UPackage* Package = CreatePackage(*PathWithGame);
-	OutOutermostPkg = Package->GetOutermost();
-	Package->FullyLoad();
-
-	return Package;
+	return ModifiablePath + Name;
 }
 
 // <-------------------------------------------------------------------------------------------------------------------------
@@ -206,11 +203,8 @@ bool FAssetUtilities::ConstructAsset(const FString& Path, const FString& Type, T
 	return false;
 }
 
-bool FAssetUtilities::Construct_TypeTexture(const FString& Path, const FString& RealPath, UTexture*& OutTexture)
+bool FAssetUtilities::FetchTextureExport(const FString& RealPath, TSharedPtr<FJsonObject>& OutJsonExport, TArray<uint8>& OutData)
 {
-	if (Path.IsEmpty())
-		return false;
-
 	TSharedPtr<FJsonObject> JsonObject = API_RequestExports(RealPath);
 	if (JsonObject == nullptr)
 		return false;
@@ -220,10 +214,8 @@ bool FAssetUtilities::Construct_TypeTexture(const FString& Path, const FString&
 		return false;
 
 	const UJsonAsAssetSettings* Settings = GetDefault<UJsonAsAssetSettings>();
-	TSharedPtr<FJsonObject> JsonExport = Response[0]->AsObject();
-	FString Type = JsonExport->GetStringField(TEXT("Type"));
-	UTexture* Texture = nullptr;
-	TArray<uint8> Data = TArray<uint8>();
+	OutJsonExport = Response[0]->AsObject();
+	FString Type = OutJsonExport->GetStringField(TEXT("Type"));
 
 	// --------------- Download Texture Data ------------
 	if (Type != "TextureRenderTarget2D")
@@ -252,17 +244,35 @@ bool FAssetUtilities::Construct_TypeTexture(const FString& Path, const FString&
 			return false;
 		}
 
-		Data = HttpResponse->GetContent();
-		if (Data.Num() == 0)
+		OutData = HttpResponse->GetContent();
+		if (OutData.Num() == 0)
 			return false;
 	}
 
+	return true;
+}
+
+UTexture* FAssetUtilities::CreateTextureFromExport(const FString& Path, const TSharedPtr<FJsonObject>& JsonExport, TArray<uint8>& Data, const TArray<uint8>* DecodedData)
+{
+	const FString Type = JsonExport->GetStringField(TEXT("Type"));
+	UTexture* Texture = nullptr;
+
 	FString PackagePath;
 	FString AssetName;
 	{
 		Path.Split(".", &PackagePath, &AssetName);
 	}
 
+	// Texture2D payloads are decoded before anything is created, so one that can't be decoded leaves no empty package behind
+	TArray<uint8> LocalDecodedData;
+	if (Type == "Texture2D" && DecodedData == nullptr)
+	{
+		if (!FTextureCreatorUtilities::DecodeTexture2D(Data, JsonExport, FTextureCreatorUtilities::GetPixelFormat(JsonExport), LocalDecodedData))
+			return nullptr;
+
+		DecodedData = &LocalDecodedData;
+	}
+
 	UPackage* Package = CreatePackage(*PackagePath);
 	UPackage* OutermostPkg = Package->GetOutermost();
 	Package->FullyLoad();
@@ -270,7 +280,7 @@ bool FAssetUtilities::Construct_TypeTexture(const FString& Path, const FString&
 	FTextureCreatorUtilities TextureCreator = FTextureCreatorUtilities(AssetName, Path, Package, OutermostPkg);
 
 	if (Type == "Texture2D")
-		TextureCreator.CreateTexture2D(Texture, Data, JsonExport);
+		TextureCreator.CreateTexture2D(Texture, Data, JsonExport, DecodedData);
 	if (Type == "TextureCube")
 		TextureCreator.CreateTextureCube(Texture, Data, JsonExport);
 	if (Type == "VolumeTexture")
@@ -279,26 +289,38 @@ bool FAssetUtilities::Construct_TypeTexture(const FString& Path, const FString&
 		TextureCreator.CreateRenderTarget2D(Texture, JsonExport->GetObjectField(TEXT("Properties")));
 
 	if (Texture == nullptr)
-		return false;
+		return nullptr;
 
 	FAssetRegistryModule::AssetCreated(Texture);
 	if (!Texture->MarkPackageDirty())
-		return false;
+		return nullptr;
 
 	Package->SetDirtyFlag(true);
 	Texture->PostEditChange();
 	Texture->AddToRoot();
 	Package->FullyLoad();
 
-	// Save texture
-	if (Settings->AssetSettings.bSavePackagesOnImport)
+	return Texture;
+}
+
+void FAssetUtilities::SavePackages(const TArray<UPackage*>& Packages)
+{
+	const UJsonAsAssetSettings* Settings = GetDefault<UJsonAsAssetSettings>();
+
+	if (!Settings->AssetSettings.bSavePackagesOnImport)
+		return;
+
+#if ENGINE_MAJOR_VERSION >= 5
+	FSavePackageArgs SaveArgs;
 	{
-		FSavePackageArgs SaveArgs;
-		{
-			SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
-			SaveArgs.SaveFlags = SAVE_NoError;
-		}
+		SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+		SaveArgs.SaveFlags = SAVE_NoError;
+	}
+#endif
 
+	/* UPackage::SavePackage has to run on the game thread, so this is one sequential sweep */
+	for (UPackage* Package : Packages)
+	{
 		const FString PackageName = Package->GetName();
 		const FString PackageFileName = FPackageName::LongPackageNameToFilename(PackageName, FPackageName::GetAssetPackageExtension());
 #if ENGINE_MAJOR_VERSION >= 5
@@ -307,12 +329,121 @@ bool FAssetUtilities::Construct_TypeTexture(const FString& Path, const FString&
 		UPackage::SavePackage(Package, nullptr, RF_Standalone, *PackageFileName);
 #endif
 	}
+}
+
+bool FAssetUtilities::Construct_TypeTexture(const FString& Path, const FString& RealPath, UTexture*& OutTexture)
+{
+	if (Path.IsEmpty())
+		return false;
+
+	TSharedPtr<FJsonObject> JsonExport;
+	TArray<uint8> Data = TArray<uint8>();
+
+	if (!FetchTextureExport(RealPath, JsonExport, Data))
+		return false;
+
+	UTexture* Texture = CreateTextureFromExport(Path, JsonExport, Data);
+
+	if (Texture == nullptr)
+		return false;
+
+	// Save texture
+	SavePackages({ Texture->GetOutermost() });
 
 	OutTexture = Texture;
 
 	return true;
 }
 
+bool FAssetUtilities::Construct_TypeTextures(const TArray<FString>& Paths, TArray<UTexture*>& OutTextures)
+{
+	struct FTextureImportJob
+	{
+		FString Path;
+		TSharedPtr<FJsonObject> JsonExport;
+		TArray<uint8> Data;
+		TArray<uint8> DecodedData;
+		EPixelFormat Format = PF_Unknown;
+		bool bDecoded = false;
+	};
+
+	TArray<FTextureImportJob> Jobs;
+	Jobs.Reserve(Paths.Num());
+
+	// --------------- Fetch every export and payload first ------------
+	for (const FString& Path : Paths)
+	{
+		if (Path.IsEmpty())
+			continue;
+
+		FString RootName;
+		{
+			Path.Split("/", nullptr, &RootName, ESearchCase::IgnoreCase, ESearchDir::FromStart);
+			RootName.Split("/", &RootName, nullptr, ESearchCase::IgnoreCase, ESearchDir::FromStart);
+		}
+
+		// Missing Plugin: Create it
+		if (RootName != "Game" && RootName != "Engine" && IPluginManager::Get().FindPlugin(RootName) == nullptr)
+			CreatePlugin(RootName);
+
+		FTextureImportJob Job;
+		Job.Path = Path;
+
+		if (!FetchTextureExport(Path, Job.JsonExport, Job.Data))
+		{
+			UE_LOG(LogJson, Warning, TEXT("Failed to fetch texture \"%s\""), *Path);
+			continue;
+		}
+
+		/* Only Texture2D is decoded ahead, the rest is handled during creation */
+		if (Job.JsonExport->GetStringField(TEXT("Type")) == "Texture2D")
+			Job.Format = FTextureCreatorUtilities::GetPixelFormat(Job.JsonExport);
+
+		Jobs.Add(MoveTemp(Job));
+	}
+
+	// --------------- Decode on the shared task pool ------------
+	ParallelFor(Jobs.Num(), [&Jobs](const int32 Index) {
+		FTextureImportJob& Job = Jobs[Index];
+
+		if (Job.Format != PF_Unknown)
+			Job.bDecoded = FTextureCreatorUtilities::DecodeTexture2D(Job.Data, Job.JsonExport, Job.Format, Job.DecodedData);
+	});
+
+	// --------------- Create every texture, then save in one sweep ------------
+	TArray<UPackage*> Packages;
+	Packages.Reserve(Jobs.Num());
+
+	for (FTextureImportJob& Job : Jobs)
+	{
+		// Nothing is created for a payload that failed to decode
+		if (Job.Format != PF_Unknown && !Job.bDecoded)
+		{
+			UE_LOG(LogJson, Warning, TEXT("Failed to decode texture \"%s\""), *Job.Path);
+			continue;
+		}
+
+		UTexture* Texture = CreateTextureFromExport(Job.Path, Job.JsonExport, Job.Data, Job.bDecoded ? &Job.DecodedData : nullptr);
+
+		/* Release the payloads as soon as the texture owns its source */
+		Job.Data.Empty();
+		Job.DecodedData.Empty();
+
+		if (Texture == nullptr)
+		{
+			UE_LOG(LogJson, Warning, TEXT("Failed to create texture \"%s\""), *Job.Path);
+			continue;
+		}
+
+		OutTextures.Add(Texture);
+		Packages.Add(Texture->GetOutermost());
+	}
+
+	SavePackages(Packages);
+
+	return OutTextures.Num() == Paths.Num();
+}
+
 void FAssetUtilities::CreatePlugin(FString PluginName)
 {
 	// Plugin creation is different between UE5 and UE4
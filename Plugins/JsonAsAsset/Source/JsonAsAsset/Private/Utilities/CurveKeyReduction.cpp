@@ -0,0 +1,267 @@
+// Copyright JAA Contributors 2024-2025
+
+#include "Utilities/CurveKeyReduction.h"
+
+#include "Settings/JsonAsAssetSettings.h"
+#include "Misc/AutomationTest.h"
+#include "Json.h"
+
+void FCurveKeyReductionResult::Append(const FCurveKeyReductionResult& Other) {
+	KeysBefore += Other.KeysBefore;
+	KeysAfter += Other.KeysAfter;
+	MaxError = FMath::Max(MaxError, Other.MaxError);
+}
+
+bool FCurveKeyReduction::IsEnabled(float& OutTolerance) {
+	const FJCurveImportSettings& Settings = GetDefault<UJsonAsAssetSettings>()->AssetSettings.CurveImportSettings;
+
+	OutTolerance = FMath::Max(Settings.KeyReductionTolerance, 0.0f);
+	return Settings.bReduceCurveKeys;
+}
+
+FCurveKeyReductionResult FCurveKeyReduction::ReduceKeys(TArray<FRichCurveKey>& Keys, const float Tolerance) {
+	FCurveKeyReductionResult Result;
+	Result.KeysBefore = Keys.Num();
+	Result.KeysAfter = Keys.Num();
+
+	if (Keys.Num() < 3) {
+		return Result;
+	}
+
+	for (int32 Index = 1; Index < Keys.Num(); Index++) {
+		if (Keys[Index].Time < Keys[Index - 1].Time) return Result;
+	}
+
+	// Grows each segment from the last kept key for as long as it stays within the tolerance
+	TArray<int32> Kept;
+	Kept.Add(0);
+
+	int32 End = 1;
+
+	while (End < Keys.Num()) {
+		if (End + 1 < Keys.Num() && CanExtendSegment(Keys, Kept, End + 1, Tolerance)) {
+			End++;
+			continue;
+		}
+
+		Kept.Add(End);
+		End++;
+	}
+
+	if (Kept.Num() == Keys.Num()) {
+		return Result;
+	}
+
+	// Kept keys get the tangents they are measured with, auto tangents follow their new neighbours
+	TArray<FRichCurveKey> Reduced;
+	Reduced.Reserve(Kept.Num());
+
+	for (int32 Index = 0; Index < Kept.Num(); Index++) {
+		const int32 Prev = Index > 0 ? Kept[Index - 1] : INDEX_NONE;
+		const int32 Next = Index + 1 < Kept.Num() ? Kept[Index + 1] : INDEX_NONE;
+
+		Reduced.Add(GetKeptKey(Keys, Prev, Kept[Index], Next));
+
+		if (Next != INDEX_NONE) {
+			float Error;
+			GetSegmentError(Keys, Prev, Kept[Index], Next, Index + 2 < Kept.Num() ? Kept[Index + 2] : INDEX_NONE, Error);
+
+			Result.MaxError = FMath::Max(Result.MaxError, Error);
+		}
+	}
+
+	Result.KeysAfter = Reduced.Num();
+	Keys = MoveTemp(Reduced);
+
+	return Result;
+}
+
+void FCurveKeyReduction::Report(const FString& AssetName, const FCurveKeyReductionResult& Result) {
+	UE_LOG(LogJson, Log, TEXT("Reduced curve keys of %s: %d -> %d keys, max error %g"), *AssetName, Result.KeysBefore, Result.KeysAfter, Result.MaxError);
+}
+
+float FCurveKeyReduction::EvaluateSegment(const FRichCurveKey& From, const FRichCurveKey& To, const float Time) {
+	const float Diff = To.Time - From.Time;
+
+	if (Diff <= 0.0f || From.InterpMode == RCIM_Constant) {
+		return From.Value;
+	}
+
+	const float Alpha = (Time - From.Time) / Diff;
+
+	if (From.InterpMode == RCIM_Linear) {
+		return FMath::Lerp(From.Value, To.Value, Alpha);
+	}
+
+	// Same bezier form as FRichCurve::Eval, for unweighted tangents
+	const float P0 = From.Value;
+	const float P1 = From.Value + From.LeaveTangent * Diff / 3.0f;
+	const float P2 = To.Value - To.ArriveTangent * Diff / 3.0f;
+	const float P3 = To.Value;
+
+	const float P01 = FMath::Lerp(P0, P1, Alpha);
+	const float P12 = FMath::Lerp(P1, P2, Alpha);
+	const float P23 = FMath::Lerp(P2, P3, Alpha);
+
+	return FMath::Lerp(FMath::Lerp(P01, P12, Alpha), FMath::Lerp(P12, P23, Alpha), Alpha);
+}
+
+float FCurveKeyReduction::GetSegmentDifference(const FRichCurveKey& From, const FRichCurveKey& To, const FRichCurveKey& SubFrom, const FRichCurveKey& SubTo) {
+	// The difference is a cubic over the original segment, found from four samples
+	float D[4];
+
+	for (int32 Index = 0; Index < 4; Index++) {
+		const float Time = FMath::Lerp(SubFrom.Time, SubTo.Time, Index / 3.0f);
+		D[Index] = EvaluateSegment(From, To, Time) - EvaluateSegment(SubFrom, SubTo, Time);
+	}
+
+	const float A = D[0];
+	const float B = (-11.0f * D[0] + 18.0f * D[1] - 9.0f * D[2] + 2.0f * D[3]) * 0.5f;
+	const float C = (2.0f * D[0] - 5.0f * D[1] + 4.0f * D[2] - D[3]) * 4.5f;
+	const float E = (-D[0] + 3.0f * D[1] - 3.0f * D[2] + D[3]) * 4.5f;
+
+	auto Evaluate = [A, B, C, E](const float U) {
+		return A + U * (B + U * (C + U * E));
+	};
+
+	float MaxDifference = FMath::Max(FMath::Abs(D[0]), FMath::Abs(D[3]));
+
+	// Extremes inside the segment are where the derivative 3E u^2 + 2C u + B is zero
+	float Roots[2];
+	int32 NumRoots = 0;
+
+	if (FMath::IsNearlyZero(E)) {
+		if (!FMath::IsNearlyZero(C)) {
+			Roots[NumRoots++] = -B / (2.0f * C);
+		}
+	} else {
+		const float Discriminant = C * C - 3.0f * E * B;
+
+		if (Discriminant >= 0.0f) {
+			const float Root = FMath::Sqrt(Discriminant);
+
+			Roots[NumRoots++] = (-C + Root) / (3.0f * E);
+			Roots[NumRoots++] = (-C - Root) / (3.0f * E);
+		}
+	}
+
+	for (int32 Index = 0; Index < NumRoots; Index++) {
+		if (Roots[Index] > 0.0f && Roots[Index] < 1.0f) {
+			MaxDifference = FMath::Max(MaxDifference, FMath::Abs(Evaluate(Roots[Index])));
+		}
+	}
+
+	return MaxDifference;
+}
+
+bool FCurveKeyReduction::HasKnownTangents(const FRichCurveKey& Key) {
+	return Key.InterpMode != RCIM_Cubic || Key.TangentMode == RCTM_User || Key.TangentMode == RCTM_Break || Key.TangentMode == RCTM_Auto;
+}
+
+FRichCurveKey FCurveKeyReduction::GetKeptKey(const TArray<FRichCurveKey>& Keys, const int32 Prev, const int32 Index, const int32 Next) {
+	FRichCurveKey Key = Keys[Index];
+
+	// Tangents that don't follow their neighbours, or neighbours that are still the original ones, stay as exported
+	const int32 OriginalNext = Index + 1 < Keys.Num() ? Index + 1 : INDEX_NONE;
+	if (Key.TangentMode != RCTM_Auto || (Prev == Index - 1 && Next == OriginalNext)) {
+		return Key;
+	}
+
+	// Same as FRichCurve::AutoSetTangents, without tension
+	if (Prev == INDEX_NONE) {
+		if (Next != INDEX_NONE) Key.LeaveTangent = 0.0f;
+	} else if (Next == INDEX_NONE) {
+		Key.ArriveTangent = 0.0f;
+	} else if (Key.InterpMode == RCIM_Cubic) {
+		const float Tangent = (Keys[Next].Value - Keys[Prev].Value) / FMath::Max(KINDA_SMALL_NUMBER, Keys[Next].Time - Keys[Prev].Time);
+
+		Key.ArriveTangent = Tangent;
+		Key.LeaveTangent = Tangent;
+	}
+
+	return Key;
+}
+
+bool FCurveKeyReduction::GetSegmentError(const TArray<FRichCurveKey>& Keys, const int32 Prev, const int32 From, const int32 To, const int32 Next, float& OutError) {
+	OutError = 0.0f;
+
+	// Other tangent modes are recomputed in ways that aren't modeled here, those keys are always kept
+	if (!HasKnownTangents(Keys[From]) || !HasKnownTangents(Keys[To])) return false;
+
+	for (int32 Index = From; Index <= To; Index++) {
+		// Weighted tangents aren't evaluated here, those keys are always kept
+		if (Keys[Index].TangentWeightMode != RCTWM_WeightedNone) return false;
+	}
+
+	// The segment as it is written, against the original keys it replaces
+	const FRichCurveKey FromKey = GetKeptKey(Keys, Prev, From, To);
+	const FRichCurveKey ToKey = GetKeptKey(Keys, From, To, Next);
+
+	for (int32 Index = From; Index < To; Index++) {
+		OutError = FMath::Max(OutError, GetSegmentDifference(FromKey, ToKey, Keys[Index], Keys[Index + 1]));
+	}
+
+	return true;
+}
+
+bool FCurveKeyReduction::CanExtendSegment(const TArray<FRichCurveKey>& Keys, const TArray<int32>& Kept, const int32 To, const float Tolerance) {
+	const int32 Anchor = Kept.Last();
+	const int32 Prev = Kept.Num() > 1 ? Kept[Kept.Num() - 2] : INDEX_NONE;
+	const int32 Next = To + 1 < Keys.Num() ? To + 1 : INDEX_NONE;
+
+	float Error;
+
+	// Auto tangents of the anchor and of To follow the new neighbours, so the segments on both sides change too
+	if (!GetSegmentError(Keys, Prev, Anchor, To, Next, Error) || Error > Tolerance) return false;
+
+	if (Prev != INDEX_NONE) {
+		const int32 PrevPrev = Kept.Num() > 2 ? Kept[Kept.Num() - 3] : INDEX_NONE;
+		if (!GetSegmentError(Keys, PrevPrev, Prev, Anchor, To, Error) || Error > Tolerance) return false;
+	}
+
+	if (Next != INDEX_NONE) {
+		if (!GetSegmentError(Keys, Anchor, To, Next, Next + 1 < Keys.Num() ? Next + 1 : INDEX_NONE, Error) || Error > Tolerance) return false;
+	}
+
+	return true;
+}
+
+#if WITH_DEV_AUTOMATION_TESTS
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FCurveKeyReductionAutoTangentTest, "JsonAsAsset.CurveKeyReduction.AutoTangents", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool FCurveKeyReductionAutoTangentTest::RunTest(const FString& Parameters) {
+	// A densely sampled sine with auto tangents, like most exported float and vector curves
+	FRichCurve Curve;
+
+	for (int32 Index = 0; Index <= 120; Index++) {
+		const float Time = Index / 30.0f;
+		const FKeyHandle Handle = Curve.AddKey(Time, FMath::Sin(Time * PI));
+
+		Curve.SetKeyInterpMode(Handle, RCIM_Cubic);
+		Curve.SetKeyTangentMode(Handle, RCTM_Auto);
+	}
+
+	Curve.AutoSetTangents();
+
+	TArray<FRichCurveKey> Keys = Curve.GetConstRefOfKeys();
+	const FCurveKeyReductionResult Result = FCurveKeyReduction::ReduceKeys(Keys, 0.01f);
+
+	TestTrue(TEXT("Auto tangent keys are reduced"), Result.KeysAfter < Result.KeysBefore);
+	TestTrue(TEXT("Reduction stays within the tolerance"), Result.MaxError <= 0.01f);
+
+	// The written keys evaluate within the tolerance, once the engine sets their auto tangents again
+	FRichCurve Reduced;
+	Reduced.SetKeys(Keys);
+	Reduced.AutoSetTangents();
+
+	float MaxError = 0.0f;
+	for (int32 Sample = 0; Sample <= 400; Sample++) {
+		const float Time = Sample / 100.0f;
+		MaxError = FMath::Max(MaxError, FMath::Abs(Reduced.Eval(Time) - Curve.Eval(Time)));
+	}
+
+	TestTrue(TEXT("Reduced curve matches the original"), MaxError <= 0.01f + KINDA_SMALL_NUMBER);
+
+	return true;
+}
+#endif
@@ -0,0 +1,275 @@
+// Copyright JAA Contributors 2024-2025
+
+#include "Utilities/JsonStreamUtilities.h"
+
+#include "Dom/JsonObject.h"
+#include "HAL/FileManager.h"
+
+/*
+ * Serves a UTF-8 file as the stream of TCHARs TJsonReader reads, one character at
+ * a time. The reader steps back over the last character it read when it peeks, a
+ * short history of decoded characters is kept for that.
+ */
+class FUtf8FileArchive : public FArchive {
+public:
+	explicit FUtf8FileArchive(FArchive* InFile) : File(InFile) {
+		SetIsLoading(true);
+		Buffer.SetNumUninitialized(BufferSize);
+
+		// A byte order mark isn't part of the Json
+		if (FillBuffer() && ByteNum >= 3 && Buffer[0] == 0xEF && Buffer[1] == 0xBB && Buffer[2] == 0xBF) {
+			BytePos = 3;
+		}
+	}
+
+	virtual void Serialize(void* Data, int64 Length) override {
+		TCHAR* Chars = static_cast<TCHAR*>(Data);
+
+		for (int64 Index = 0; Index < Length / static_cast<int64>(sizeof(TCHAR)); Index++) {
+			if (!NextChar(Chars[Index])) {
+				Chars[Index] = 0;
+				SetError();
+			}
+		}
+	}
+
+	virtual int64 Tell() override {
+		return Position * sizeof(TCHAR);
+	}
+
+	virtual void Seek(const int64 InPos) override {
+		const int64 Target = InPos / sizeof(TCHAR);
+
+		if (Target > Decoded || Decoded - Target > HistorySize) {
+			SetError();
+			return;
+		}
+
+		Position = Target;
+	}
+
+	virtual bool AtEnd() override {
+		return Position == Decoded && !bHasLowSurrogate && !FillBuffer();
+	}
+
+	virtual FString GetArchiveName() const override {
+		return TEXT("FUtf8FileArchive");
+	}
+
+private:
+	static constexpr int64 BufferSize = 64 * 1024;
+	static constexpr int64 HistorySize = 64;
+
+	TUniquePtr<FArchive> File;
+
+	TArray<uint8> Buffer;
+	int64 BytePos = 0;
+	int64 ByteNum = 0;
+
+	/* Characters decoded so far, and the one the reader is at */
+	TCHAR History[HistorySize];
+	int64 Decoded = 0;
+	int64 Position = 0;
+
+	/* Second half of a character outside of the basic plane, when TCHAR is UTF-16 */
+	TCHAR LowSurrogate = 0;
+	bool bHasLowSurrogate = false;
+
+	bool FillBuffer() {
+		if (BytePos < ByteNum) return true;
+
+		const int64 Remaining = File->TotalSize() - File->Tell();
+		if (Remaining <= 0 || File->IsError()) return false;
+
+		ByteNum = FMath::Min(Remaining, BufferSize);
+		BytePos = 0;
+
+		File->Serialize(Buffer.GetData(), ByteNum);
+
+		return !File->IsError();
+	}
+
+	bool ReadByte(uint8& OutByte) {
+		if (!FillBuffer()) return false;
+
+		OutByte = Buffer[BytePos++];
+		return true;
+	}
+
+	bool NextChar(TCHAR& OutChar) {
+		// Stepped back, the character was decoded already
+		if (Position < Decoded) {
+			OutChar = History[Position % HistorySize];
+			Position++;
+
+			return true;
+		}
+
+		if (!DecodeChar(OutChar)) return false;
+
+		History[Decoded % HistorySize] = OutChar;
+		Decoded++;
+		Position++;
+
+		return true;
+	}
+
+	bool DecodeChar(TCHAR& OutChar) {
+		if (bHasLowSurrogate) {
+			OutChar = LowSurrogate;
+			bHasLowSurrogate = false;
+
+			return true;
+		}
+
+		uint8 Lead;
+		if (!ReadByte(Lead)) return false;
+
+		uint32 CodePoint = Lead;
+		int32 Continuation = 0;
+
+		if ((Lead & 0xE0) == 0xC0) {
+			CodePoint = Lead & 0x1F;
+			Continuation = 1;
+		} else if ((Lead & 0xF0) == 0xE0) {
+			CodePoint = Lead & 0x0F;
+			Continuation = 2;
+		} else if ((Lead & 0xF8) == 0xF0) {
+			CodePoint = Lead & 0x07;
+			Continuation = 3;
+		} else if (Lead >= 0x80) {
+			CodePoint = 0xFFFD;
+		}
+
+		for (int32 Index = 0; Index < Continuation; Index++) {
+			uint8 Byte;
+
+			if (!ReadByte(Byte) || (Byte & 0xC0) != 0x80) {
+				CodePoint = 0xFFFD;
+				break;
+			}
+
+			CodePoint = (CodePoint << 6) | (Byte & 0x3F);
+		}
+
+		if (sizeof(TCHAR) == 2 && CodePoint > 0xFFFF) {
+			CodePoint -= 0x10000;
+
+			OutChar = static_cast<TCHAR>(0xD800 + (CodePoint >> 10));
+			LowSurrogate = static_cast<TCHAR>(0xDC00 + (CodePoint & 0x3FF));
+			bHasLowSurrogate = true;
+
+			return true;
+		}
+
+		OutChar = static_cast<TCHAR>(CodePoint);
+		return true;
+	}
+};
+
+TSharedPtr<FJsonFileReader> FJsonFileReader::Create(const FString& File) {
+	FArchive* FileArchive = IFileManager::Get().CreateFileReader(*File);
+
+	if (FileArchive == nullptr) {
+		return nullptr;
+	}
+
+	return MakeShareable(new FJsonFileReader(new FUtf8FileArchive(FileArchive)));
+}
+
+FJsonFileReader::FJsonFileReader(FArchive* InArchive) : TJsonReader<TCHAR>(InArchive), Archive(InArchive) {
+}
+
+TSharedPtr<FJsonValue> FJsonStreamUtilities::ReadValue(TJsonReader<TCHAR>& Reader, const EJsonNotation Notation) {
+	switch (Notation) {
+		case EJsonNotation::ObjectStart: {
+			TSharedPtr<FJsonObject> Object = MakeShared<FJsonObject>();
+
+			EJsonNotation Next = EJsonNotation::Error;
+			while (Reader.ReadNext(Next) && Next != EJsonNotation::ObjectEnd) {
+				const FString Identifier = Reader.GetIdentifier();
+				const TSharedPtr<FJsonValue> Value = ReadValue(Reader, Next);
+
+				if (!Value.IsValid()) return nullptr;
+				Object->SetField(Identifier, Value);
+			}
+
+			if (Next != EJsonNotation::ObjectEnd) return nullptr;
+			return MakeShared<FJsonValueObject>(Object);
+		}
+
+		case EJsonNotation::ArrayStart: {
+			TArray<TSharedPtr<FJsonValue>> Array;
+
+			EJsonNotation Next = EJsonNotation::Error;
+			while (Reader.ReadNext(Next) && Next != EJsonNotation::ArrayEnd) {
+				const TSharedPtr<FJsonValue> Value = ReadValue(Reader, Next);
+
+				if (!Value.IsValid()) return nullptr;
+				Array.Add(Value);
+			}
+
+			if (Next != EJsonNotation::ArrayEnd) return nullptr;
+			return MakeShared<FJsonValueArray>(Array);
+		}
+
+		case EJsonNotation::String:
+			return MakeShared<FJsonValueString>(Reader.GetValueAsString());
+		case EJsonNotation::Number:
+			return MakeShared<FJsonValueNumber>(Reader.GetValueAsNumber());
+		case EJsonNotation::Boolean:
+			return MakeShared<FJsonValueBoolean>(Reader.GetValueAsBoolean());
+		case EJsonNotation::Null:
+			return MakeShared<FJsonValueNull>();
+
+		default:
+			return nullptr;
+	}
+}
+
+bool FJsonStreamUtilities::SkipValue(TJsonReader<TCHAR>& Reader, const EJsonNotation Notation) {
+	if (Notation == EJsonNotation::Error) return false;
+	if (Notation != EJsonNotation::ObjectStart && Notation != EJsonNotation::ArrayStart) return true;
+
+	int32 Depth = 1;
+
+	EJsonNotation Next = EJsonNotation::Error;
+	while (Depth > 0 && Reader.ReadNext(Next)) {
+		if (Next == EJsonNotation::ObjectStart || Next == EJsonNotation::ArrayStart) {
+			Depth++;
+		} else if (Next == EJsonNotation::ObjectEnd || Next == EJsonNotation::ArrayEnd) {
+			Depth--;
+		} else if (Next == EJsonNotation::Error) {
+			return false;
+		}
+	}
+
+	return Depth == 0;
+}
+
+bool FJsonStreamUtilities::ReadFirstExportHeader(const FString& File, FString& OutType, FString& OutName) {
+	OutType.Reset();
+	OutName.Reset();
+
+	const TSharedPtr<FJsonFileReader> Reader = FJsonFileReader::Create(File);
+	if (!Reader.IsValid()) return false;
+
+	EJsonNotation Notation = EJsonNotation::Error;
+	if (!Reader->ReadNext(Notation) || Notation != EJsonNotation::ArrayStart) return false;
+	if (!Reader->ReadNext(Notation) || Notation != EJsonNotation::ObjectStart) return false;
+
+	// Type and Name come first in exported files, the rest of the file is never read
+	while (Reader->ReadNext(Notation) && Notation != EJsonNotation::ObjectEnd) {
+		if (Notation == EJsonNotation::String) {
+			if (Reader->GetIdentifier() == "Type") OutType = Reader->GetValueAsString();
+			if (Reader->GetIdentifier() == "Name") OutName = Reader->GetValueAsString();
+
+			if (!OutType.IsEmpty() && !OutName.IsEmpty()) return true;
+			continue;
+		}
+
+		if (!SkipValue(*Reader, Notation)) return false;
+	}
+
+	return !OutType.IsEmpty();
+}
@@ -0,0 +1,241 @@
+// Copyright JAA Contributors 2024-2025
+
+#include "Utilities/MaterialCompileBatch.h"
+
+#include "Materials/Material.h"
+#include "Materials/MaterialFunction.h"
+#include "Materials/MaterialInstanceConstant.h"
+#include "Materials/MaterialInterface.h"
+#include "Utilities/AssetUtilities.h"
+#include "Json.h"
+
+int32 FMaterialCompileBatch::Depth = 0;
+
+TArray<TWeakObjectPtr<UMaterialFunction>> FMaterialCompileBatch::PendingFunctions;
+TArray<TWeakObjectPtr<UMaterial>> FMaterialCompileBatch::PendingMaterials;
+TArray<FMaterialCompileBatch::FPendingInstance> FMaterialCompileBatch::PendingInstances;
+TArray<TWeakObjectPtr<UPackage>> FMaterialCompileBatch::PendingPackages;
+
+TMap<FString, TWeakObjectPtr<UMaterialInterface>> FMaterialCompileBatch::Parents;
+
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 2
+TMap<TWeakObjectPtr<UMaterialInterface>, FStaticParameterSet> FMaterialCompileBatch::ParentStaticParameters;
+#endif
+
+FMaterialCompileBatch::FMaterialCompileBatch() {
+	check(IsInGameThread());
+	Depth++;
+}
+
+FMaterialCompileBatch::~FMaterialCompileBatch() {
+	// Only the outermost scope compiles
+	if (--Depth == 0) {
+		Flush();
+	}
+}
+
+bool FMaterialCompileBatch::IsActive() {
+	return Depth > 0;
+}
+
+bool FMaterialCompileBatch::Defer(UObject* Asset) {
+	if (!IsActive() || Asset == nullptr) {
+		return false;
+	}
+
+	if (UMaterial* Material = Cast<UMaterial>(Asset)) {
+		PendingMaterials.AddUnique(Material);
+		return true;
+	}
+
+	if (UMaterialFunction* MaterialFunction = Cast<UMaterialFunction>(Asset)) {
+		PendingFunctions.AddUnique(MaterialFunction);
+		return true;
+	}
+
+	if (UMaterialInstanceConstant* MaterialInstance = Cast<UMaterialInstanceConstant>(Asset)) {
+		FindOrAddInstance(MaterialInstance);
+		return true;
+	}
+
+	return false;
+}
+
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 2
+bool FMaterialCompileBatch::DeferStaticPermutation(UMaterialInstanceConstant* MaterialInstance, const FStaticParameterSet& StaticParameters) {
+	if (!IsActive() || MaterialInstance == nullptr) {
+		return false;
+	}
+
+	FindOrAddInstance(MaterialInstance).StaticParameters = StaticParameters;
+	return true;
+}
+
+bool FMaterialCompileBatch::GetParentStaticParameters(UMaterialInterface* Parent, FStaticParameterSet& OutStaticParameters) {
+	if (Parent == nullptr) {
+		return false;
+	}
+
+	if (const FStaticParameterSet* Cached = ParentStaticParameters.Find(Parent)) {
+		OutStaticParameters = *Cached;
+		return true;
+	}
+
+	/* Anything in the chain still waiting on this batch has no up to date parameters yet */
+	for (UMaterialInterface* Link = Parent; Link != nullptr; ) {
+		if (UMaterial* Material = Cast<UMaterial>(Link)) {
+			if (PendingMaterials.Contains(Material)) return false;
+			break;
+		}
+
+		UMaterialInstance* Instance = Cast<UMaterialInstance>(Link);
+		if (Instance == nullptr) break;
+
+		for (const FPendingInstance& Pending : PendingInstances) {
+			if (Pending.MaterialInstance.Get() == Instance && Pending.StaticParameters.IsSet()) return false;
+		}
+
+		Link = Instance->Parent;
+	}
+
+	Parent->GetStaticParameterValues(OutStaticParameters);
+	ParentStaticParameters.Add(Parent, OutStaticParameters);
+
+	return true;
+}
+#endif
+
+bool FMaterialCompileBatch::FindParent(const FString& ObjectPath, UMaterialInterface*& OutParent) {
+	const TWeakObjectPtr<UMaterialInterface>* Parent = Parents.Find(ObjectPath);
+	if (Parent == nullptr || !Parent->IsValid()) {
+		return false;
+	}
+
+	OutParent = Parent->Get();
+	return true;
+}
+
+void FMaterialCompileBatch::AddParent(const FString& ObjectPath, UMaterialInterface* Parent) {
+	if (IsActive() && !ObjectPath.IsEmpty() && Parent != nullptr) {
+		Parents.Add(ObjectPath, Parent);
+	}
+}
+
+void FMaterialCompileBatch::SkipRecompile(UMaterialInstanceConstant* MaterialInstance) {
+	if (IsActive() && MaterialInstance != nullptr) {
+		FindOrAddInstance(MaterialInstance).bSkipRecompile = true;
+	}
+}
+
+bool FMaterialCompileBatch::DeferSave(UPackage* Package) {
+	if (!IsActive() || Package == nullptr) {
+		return false;
+	}
+
+	TArray<UObject*> Objects;
+	GetObjectsWithOuter(Package, Objects, false);
+
+	for (const UObject* Object : Objects) {
+		if (Object->IsA<UMaterial>() || Object->IsA<UMaterialFunction>() || Object->IsA<UMaterialInstanceConstant>()) {
+			PendingPackages.AddUnique(Package);
+			return true;
+		}
+	}
+
+	return false;
+}
+
+FMaterialCompileBatch::FPendingInstance& FMaterialCompileBatch::FindOrAddInstance(UMaterialInstanceConstant* MaterialInstance) {
+	for (FPendingInstance& Pending : PendingInstances) {
+		if (Pending.MaterialInstance == MaterialInstance) {
+			return Pending;
+		}
+	}
+
+	FPendingInstance& Pending = PendingInstances.AddDefaulted_GetRef();
+	Pending.MaterialInstance = MaterialInstance;
+
+	return Pending;
+}
+
+void FMaterialCompileBatch::Flush() {
+	Parents.Empty();
+
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 2
+	ParentStaticParameters.Empty();
+#endif
+
+	if (PendingFunctions.Num() == 0 && PendingMaterials.Num() == 0 && PendingInstances.Num() == 0 && PendingPackages.Num() == 0) {
+		return;
+	}
+
+	/* Take the lists first, anything compiled below must not be deferred again */
+	const TArray<TWeakObjectPtr<UMaterialFunction>> Functions = MoveTemp(PendingFunctions);
+	const TArray<TWeakObjectPtr<UMaterial>> Materials = MoveTemp(PendingMaterials);
+	const TArray<FPendingInstance> Instances = MoveTemp(PendingInstances);
+	const TArray<TWeakObjectPtr<UPackage>> Packages = MoveTemp(PendingPackages);
+
+	FMaterialUpdateContext UpdateContext;
+
+	// Functions first, materials read their expressions when compiling
+	for (const TWeakObjectPtr<UMaterialFunction>& MaterialFunction : Functions) {
+		if (MaterialFunction.IsValid()) {
+			MaterialFunction->PostEditChange();
+		}
+	}
+
+	// An interactive change runs the rest of PostEditChange without compiling, the
+	// compile itself then happens once under the shared update context
+	for (const TWeakObjectPtr<UMaterial>& Material : Materials) {
+		if (!Material.IsValid()) continue;
+
+		UpdateContext.AddMaterial(Material.Get());
+
+		FPropertyChangedEvent PropertyChangedEvent(nullptr, EPropertyChangeType::Interactive);
+		Material->PreEditChange(nullptr);
+		Material->PostEditChangeProperty(PropertyChangedEvent);
+
+		Material->ForceRecompileForRendering();
+	}
+
+	int32 Skipped = 0;
+
+	// Instances last, so they pick up the compiled parents
+	for (const FPendingInstance& Pending : Instances) {
+		UMaterialInstanceConstant* MaterialInstance = Pending.MaterialInstance.Get();
+		if (MaterialInstance == nullptr) continue;
+
+		UpdateContext.AddMaterialInstance(MaterialInstance);
+
+		// Same static switches as the parent, the parent's shader maps are used as they are
+		if (Pending.bSkipRecompile) {
+			Skipped++;
+		}
+
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 2
+		// Updating the permutation initializes it too, a set matching the parent compiles nothing
+		if (Pending.StaticParameters.IsSet()) {
+			MaterialInstance->UpdateStaticPermutation(Pending.StaticParameters.GetValue(), &UpdateContext);
+			continue;
+		}
+#endif
+
+		if (Pending.bSkipRecompile) {
+			MaterialInstance->InitStaticPermutation();
+		} else {
+			MaterialInstance->UpdateStaticPermutation(&UpdateContext);
+		}
+	}
+
+	UE_LOG(LogJson, Log, TEXT("Compiled material batch: %d functions, %d materials, %d instances (%d sharing their parent's shaders)"), Functions.Num(), Materials.Num(), Instances.Num(), Skipped);
+
+	// Saved once their edits are final, like outside of a batch
+	TArray<UPackage*> PackagesToSave;
+	for (const TWeakObjectPtr<UPackage>& Package : Packages) {
+		if (Package.IsValid()) {
+			PackagesToSave.Add(Package.Get());
+		}
+	}
+
+	FAssetUtilities::SavePackages(PackagesToSave);
+}
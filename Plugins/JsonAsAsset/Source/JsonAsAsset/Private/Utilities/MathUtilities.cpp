@@ -2,6 +2,8 @@
 
 #include "Utilities/MathUtilities.h"
 #include "Dom/JsonObject.h"
+#include "Algo/IsSorted.h"
+#include "Algo/StableSort.h"
 
 FVector FMathUtilities::ObjectToVector(const FJsonObject* Object) {
 	return FVector(Object->GetNumberField(TEXT("X")), Object->GetNumberField(TEXT("Y")), Object->GetNumberField(TEXT("Z")));
@@ -60,3 +62,16 @@ FRichCurveKey FMathUtilities::ObjectToRichCurveKey(const TSharedPtr<FJsonObject>
 	FString InterpMode = Object->GetStringField(TEXT("InterpMode"));
 	return FRichCurveKey(Object->GetNumberField(TEXT("Time")), Object->GetNumberField(TEXT("Value")), Object->GetNumberField(TEXT("ArriveTangent")), Object->GetNumberField(TEXT("LeaveTangent")), static_cast<ERichCurveInterpMode>(StaticEnum<ERichCurveInterpMode>()->GetValueByNameString(InterpMode)));
 }
+
+void FMathUtilities::ObjectsToRichCurveKeys(const TArray<TSharedPtr<FJsonValue>>& Objects, TArray<FRichCurveKey>& OutKeys) {
+	OutKeys.Reset(Objects.Num());
+
+	for (const TSharedPtr<FJsonValue>& Object : Objects) {
+		OutKeys.Add(ObjectToRichCurveKey(Object->AsObject()));
+	}
+
+	// AddKey would have inserted them in order, keys with the same time keep theirs
+	if (!Algo::IsSortedBy(OutKeys, &FRichCurveKey::Time)) {
+		Algo::StableSortBy(OutKeys, &FRichCurveKey::Time);
+	}
+}
@@ -9,6 +9,42 @@ PRAGMA_DISABLE_OPTIMIZATION
 
 TSet<FName> UObjectSerializer::UnhandledNativeClasses;
 
+// Property Write ------------------------
+FPropertyWrite::FPropertyWrite(FPropertyWrite&& Other) :
+	Property(Other.Property),
+	ArrayIndex(Other.ArrayIndex),
+	Value(Other.Value),
+	JsonValue(MoveTemp(Other.JsonValue)) {
+	Other.Value = nullptr;
+}
+
+FPropertyWrite& FPropertyWrite::operator=(FPropertyWrite&& Other) {
+	if (this != &Other) {
+		if (Value != nullptr) {
+			Property->DestroyValue(Value);
+			FMemory::Free(Value);
+		}
+
+		Property = Other.Property;
+		ArrayIndex = Other.ArrayIndex;
+		Value = Other.Value;
+		JsonValue = MoveTemp(Other.JsonValue);
+
+		Other.Value = nullptr;
+	}
+
+	return *this;
+}
+
+FPropertyWrite::~FPropertyWrite() {
+	if (Value != nullptr) {
+		Property->DestroyValue(Value);
+		FMemory::Free(Value);
+		Value = nullptr;
+	}
+}
+// ----------------------------------------
+
 // Object Compare Settings ---------------
 FObjectCompareSettings::FObjectCompareSettings() :
 	bCheckObjectName(true),
@@ -437,6 +473,79 @@ void UObjectSerializer::DeserializeObjectProperties(const TSharedPtr<FJsonObject
 		}
 	}
 
+	DeserializeStaticMeshLODData(Properties, Object);
+}
+
+void UObjectSerializer::DecodeObjectProperties(const TSharedPtr<FJsonObject>& Properties, UObject* Object, TArray<FPropertyWrite>& OutWrites) const {
+	if (Object == nullptr) return;
+
+	UClass* ObjectClass = Object->GetClass();
+
+	for (FProperty* Property = ObjectClass->PropertyLink; Property; Property = Property->PropertyLinkNext) {
+		if (!PropertySerializer->ShouldSerializeProperty(Property)) continue;
+
+		const FString PropertyName = Property->GetName();
+
+		// Static arrays, in the format of PropertyName[Index]
+		if (Property->ArrayDim != 1) {
+			TArray<TSharedPtr<FJsonValue>> ArrayElements;
+			CollectStaticArrayElements(PropertyName, Properties, ArrayElements);
+
+			for (int32 ArrayIndex = 0; ArrayIndex < ArrayElements.Num() && ArrayIndex < Property->ArrayDim; ArrayIndex++) {
+				DecodePropertyWrite(Property, ArrayIndex, ArrayElements[ArrayIndex], Object, OutWrites);
+			}
+
+			continue;
+		}
+
+		if (PropertyName == "LODParentPrimitive") continue;
+
+		if (const TSharedPtr<FJsonValue>* ValueObject = Properties->Values.Find(PropertyName)) {
+			DecodePropertyWrite(Property, 0, *ValueObject, Object, OutWrites);
+		}
+	}
+}
+
+void UObjectSerializer::DecodePropertyWrite(FProperty* Property, const int32 ArrayIndex, const TSharedPtr<FJsonValue>& JsonValue, UObject* Object, TArray<FPropertyWrite>& OutWrites) const {
+	if (!JsonValue.IsValid() || JsonValue->IsNull()) return;
+
+	FPropertyWrite& Write = OutWrites.AddDefaulted_GetRef();
+	Write.Property = Property;
+	Write.ArrayIndex = ArrayIndex;
+
+	if (Property->ArrayDim != 1 || !PropertySerializer->CanDeserializeOffGameThread(Property)) {
+		Write.JsonValue = JsonValue;
+		return;
+	}
+
+	// Starts from the current value, the json may only carry some of the fields
+	Write.Value = FMemory::Malloc(Property->ElementSize, Property->GetMinAlignment());
+	Property->InitializeValue(Write.Value);
+	Property->CopySingleValue(Write.Value, Property->ContainerPtrToValuePtr<void>(Object));
+
+	PropertySerializer->DeserializePropertyValueInner(Property, JsonValue.ToSharedRef(), Write.Value);
+}
+
+void UObjectSerializer::ApplyObjectProperties(TArray<FPropertyWrite>& Writes, const TSharedPtr<FJsonObject>& Properties, UObject* Object) {
+	check(IsInGameThread());
+	if (Object == nullptr) return;
+
+	for (FPropertyWrite& Write : Writes) {
+		void* PropertyValue = Write.Property->ContainerPtrToValuePtr<void>(Object, Write.ArrayIndex);
+
+		if (Write.Value != nullptr) {
+			Write.Property->CopySingleValue(PropertyValue, Write.Value);
+		} else {
+			PropertySerializer->DeserializePropertyValueInner(Write.Property, Write.JsonValue.ToSharedRef(), PropertyValue);
+		}
+	}
+
+	Writes.Empty();
+
+	DeserializeStaticMeshLODData(Properties, Object);
+}
+
+void UObjectSerializer::DeserializeStaticMeshLODData(const TSharedPtr<FJsonObject>& Properties, UObject* Object) {
 	// this is a use case for importing maps and parsing static mesh components
 	// using the object and property serializer, this was initially wanted to be
 	// done completely without any manual work (using the de-serializers)
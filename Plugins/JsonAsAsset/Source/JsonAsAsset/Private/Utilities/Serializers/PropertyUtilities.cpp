@@ -2,10 +2,10 @@
 
 #include "Utilities/Serializers/PropertyUtilities.h"
 
-#include "GameplayTagContainer.h"
 #include "Importers/Constructor/Importer.h"
 #include "Utilities/Serializers/ObjectUtilities.h"
 #include "UObject/TextProperty.h"
+#include "Curves/RichCurve.h"
 
 DECLARE_LOG_CATEGORY_CLASS(LogPropertySerializer, Error, Log);
 PRAGMA_DISABLE_OPTIMIZATION
@@ -44,6 +44,195 @@ bool FTimespanSerializer::Compare(UScriptStruct* Struct, const TSharedPtr<FJsonO
 	return Timespan->GetTicks() == Ticks;
 }
 
+/* Only fields present in the json are written, like the fallback serializer */
+template <typename TNumber>
+static void ReadNumberField(const TSharedPtr<FJsonObject>& JsonValue, const TCHAR* FieldName, TNumber& OutNumber) {
+	double Number;
+
+	if (JsonValue->TryGetNumberField(FieldName, Number)) {
+		OutNumber = static_cast<TNumber>(Number);
+	}
+}
+
+template <typename TEnum>
+static void ReadEnumField(const TSharedPtr<FJsonObject>& JsonValue, const TCHAR* FieldName, TEnumAsByte<TEnum>& OutEnum) {
+	const TSharedPtr<FJsonValue>* Value = JsonValue->Values.Find(FieldName);
+	if (Value == nullptr || !Value->IsValid()) return;
+
+	if ((*Value)->Type == EJson::String) {
+		const int64 EnumValue = StaticEnum<TEnum>()->GetValueByNameString((*Value)->AsString());
+
+		if (EnumValue != INDEX_NONE) {
+			OutEnum = static_cast<TEnum>(EnumValue);
+		}
+	} else {
+		OutEnum = static_cast<TEnum>(static_cast<uint8>((*Value)->AsNumber()));
+	}
+}
+
+template <typename TEnum>
+static void WriteEnumField(const TSharedPtr<FJsonObject>& JsonValue, const TCHAR* FieldName, TEnumAsByte<TEnum> Enum) {
+	JsonValue->SetStringField(FieldName, StaticEnum<TEnum>()->GetNameStringByValue(Enum.GetValue()));
+}
+
+template <>
+void TNativeStructSerializer<FVector>::Read(const TSharedPtr<FJsonObject>& JsonValue, FVector& OutValue) {
+	ReadNumberField(JsonValue, TEXT("X"), OutValue.X);
+	ReadNumberField(JsonValue, TEXT("Y"), OutValue.Y);
+	ReadNumberField(JsonValue, TEXT("Z"), OutValue.Z);
+}
+
+template <>
+void TNativeStructSerializer<FVector>::Write(const FVector& Value, const TSharedPtr<FJsonObject>& JsonValue) {
+	JsonValue->SetNumberField(TEXT("X"), Value.X);
+	JsonValue->SetNumberField(TEXT("Y"), Value.Y);
+	JsonValue->SetNumberField(TEXT("Z"), Value.Z);
+}
+
+template <>
+void TNativeStructSerializer<FRotator>::Read(const TSharedPtr<FJsonObject>& JsonValue, FRotator& OutValue) {
+	ReadNumberField(JsonValue, TEXT("Pitch"), OutValue.Pitch);
+	ReadNumberField(JsonValue, TEXT("Yaw"), OutValue.Yaw);
+	ReadNumberField(JsonValue, TEXT("Roll"), OutValue.Roll);
+}
+
+template <>
+void TNativeStructSerializer<FRotator>::Write(const FRotator& Value, const TSharedPtr<FJsonObject>& JsonValue) {
+	JsonValue->SetNumberField(TEXT("Pitch"), Value.Pitch);
+	JsonValue->SetNumberField(TEXT("Yaw"), Value.Yaw);
+	JsonValue->SetNumberField(TEXT("Roll"), Value.Roll);
+}
+
+template <>
+void TNativeStructSerializer<FQuat>::Read(const TSharedPtr<FJsonObject>& JsonValue, FQuat& OutValue) {
+	ReadNumberField(JsonValue, TEXT("X"), OutValue.X);
+	ReadNumberField(JsonValue, TEXT("Y"), OutValue.Y);
+	ReadNumberField(JsonValue, TEXT("Z"), OutValue.Z);
+	ReadNumberField(JsonValue, TEXT("W"), OutValue.W);
+}
+
+template <>
+void TNativeStructSerializer<FQuat>::Write(const FQuat& Value, const TSharedPtr<FJsonObject>& JsonValue) {
+	JsonValue->SetNumberField(TEXT("X"), Value.X);
+	JsonValue->SetNumberField(TEXT("Y"), Value.Y);
+	JsonValue->SetNumberField(TEXT("Z"), Value.Z);
+	JsonValue->SetNumberField(TEXT("W"), Value.W);
+}
+
+template <>
+void TNativeStructSerializer<FLinearColor>::Read(const TSharedPtr<FJsonObject>& JsonValue, FLinearColor& OutValue) {
+	ReadNumberField(JsonValue, TEXT("R"), OutValue.R);
+	ReadNumberField(JsonValue, TEXT("G"), OutValue.G);
+	ReadNumberField(JsonValue, TEXT("B"), OutValue.B);
+	ReadNumberField(JsonValue, TEXT("A"), OutValue.A);
+}
+
+template <>
+void TNativeStructSerializer<FLinearColor>::Write(const FLinearColor& Value, const TSharedPtr<FJsonObject>& JsonValue) {
+	JsonValue->SetNumberField(TEXT("R"), Value.R);
+	JsonValue->SetNumberField(TEXT("G"), Value.G);
+	JsonValue->SetNumberField(TEXT("B"), Value.B);
+	JsonValue->SetNumberField(TEXT("A"), Value.A);
+}
+
+template <>
+void TNativeStructSerializer<FColor>::Read(const TSharedPtr<FJsonObject>& JsonValue, FColor& OutValue) {
+	ReadNumberField(JsonValue, TEXT("B"), OutValue.B);
+	ReadNumberField(JsonValue, TEXT("G"), OutValue.G);
+	ReadNumberField(JsonValue, TEXT("R"), OutValue.R);
+	ReadNumberField(JsonValue, TEXT("A"), OutValue.A);
+}
+
+template <>
+void TNativeStructSerializer<FColor>::Write(const FColor& Value, const TSharedPtr<FJsonObject>& JsonValue) {
+	JsonValue->SetNumberField(TEXT("B"), Value.B);
+	JsonValue->SetNumberField(TEXT("G"), Value.G);
+	JsonValue->SetNumberField(TEXT("R"), Value.R);
+	JsonValue->SetNumberField(TEXT("A"), Value.A);
+}
+
+template <>
+void TNativeStructSerializer<FGuid>::Read(const TSharedPtr<FJsonObject>& JsonValue, FGuid& OutValue) {
+	ReadNumberField(JsonValue, TEXT("A"), OutValue.A);
+	ReadNumberField(JsonValue, TEXT("B"), OutValue.B);
+	ReadNumberField(JsonValue, TEXT("C"), OutValue.C);
+	ReadNumberField(JsonValue, TEXT("D"), OutValue.D);
+}
+
+template <>
+void TNativeStructSerializer<FGuid>::Write(const FGuid& Value, const TSharedPtr<FJsonObject>& JsonValue) {
+	JsonValue->SetNumberField(TEXT("A"), Value.A);
+	JsonValue->SetNumberField(TEXT("B"), Value.B);
+	JsonValue->SetNumberField(TEXT("C"), Value.C);
+	JsonValue->SetNumberField(TEXT("D"), Value.D);
+}
+
+template <>
+void TNativeStructSerializer<FRichCurveKey>::Read(const TSharedPtr<FJsonObject>& JsonValue, FRichCurveKey& OutValue) {
+	ReadEnumField(JsonValue, TEXT("InterpMode"), OutValue.InterpMode);
+	ReadEnumField(JsonValue, TEXT("TangentMode"), OutValue.TangentMode);
+	ReadEnumField(JsonValue, TEXT("TangentWeightMode"), OutValue.TangentWeightMode);
+
+	ReadNumberField(JsonValue, TEXT("Time"), OutValue.Time);
+	ReadNumberField(JsonValue, TEXT("Value"), OutValue.Value);
+	ReadNumberField(JsonValue, TEXT("ArriveTangent"), OutValue.ArriveTangent);
+	ReadNumberField(JsonValue, TEXT("ArriveTangentWeight"), OutValue.ArriveTangentWeight);
+	ReadNumberField(JsonValue, TEXT("LeaveTangent"), OutValue.LeaveTangent);
+	ReadNumberField(JsonValue, TEXT("LeaveTangentWeight"), OutValue.LeaveTangentWeight);
+}
+
+template <>
+void TNativeStructSerializer<FRichCurveKey>::Write(const FRichCurveKey& Value, const TSharedPtr<FJsonObject>& JsonValue) {
+	WriteEnumField(JsonValue, TEXT("InterpMode"), Value.InterpMode);
+	WriteEnumField(JsonValue, TEXT("TangentMode"), Value.TangentMode);
+	WriteEnumField(JsonValue, TEXT("TangentWeightMode"), Value.TangentWeightMode);
+
+	JsonValue->SetNumberField(TEXT("Time"), Value.Time);
+	JsonValue->SetNumberField(TEXT("Value"), Value.Value);
+	JsonValue->SetNumberField(TEXT("ArriveTangent"), Value.ArriveTangent);
+	JsonValue->SetNumberField(TEXT("ArriveTangentWeight"), Value.ArriveTangentWeight);
+	JsonValue->SetNumberField(TEXT("LeaveTangent"), Value.LeaveTangent);
+	JsonValue->SetNumberField(TEXT("LeaveTangentWeight"), Value.LeaveTangentWeight);
+}
+
+template <>
+void TNativeStructSerializer<FTransform>::Read(const TSharedPtr<FJsonObject>& JsonValue, FTransform& OutValue) {
+	const TSharedPtr<FJsonObject>* Field;
+
+	if (JsonValue->TryGetObjectField(TEXT("Rotation"), Field)) {
+		FQuat Rotation = OutValue.GetRotation();
+		TNativeStructSerializer<FQuat>::Read(*Field, Rotation);
+		OutValue.SetRotation(Rotation);
+	}
+
+	if (JsonValue->TryGetObjectField(TEXT("Translation"), Field)) {
+		FVector Translation = OutValue.GetTranslation();
+		TNativeStructSerializer<FVector>::Read(*Field, Translation);
+		OutValue.SetTranslation(Translation);
+	}
+
+	if (JsonValue->TryGetObjectField(TEXT("Scale3D"), Field)) {
+		FVector Scale3D = OutValue.GetScale3D();
+		TNativeStructSerializer<FVector>::Read(*Field, Scale3D);
+		OutValue.SetScale3D(Scale3D);
+	}
+}
+
+template <>
+void TNativeStructSerializer<FTransform>::Write(const FTransform& Value, const TSharedPtr<FJsonObject>& JsonValue) {
+	const TSharedPtr<FJsonObject> Rotation = MakeShared<FJsonObject>();
+	const TSharedPtr<FJsonObject> Translation = MakeShared<FJsonObject>();
+	const TSharedPtr<FJsonObject> Scale3D = MakeShared<FJsonObject>();
+
+	TNativeStructSerializer<FQuat>::Write(Value.GetRotation(), Rotation);
+	TNativeStructSerializer<FVector>::Write(Value.GetTranslation(), Translation);
+	TNativeStructSerializer<FVector>::Write(Value.GetScale3D(), Scale3D);
+
+	JsonValue->SetObjectField(TEXT("Rotation"), Rotation);
+	JsonValue->SetObjectField(TEXT("Translation"), Translation);
+	JsonValue->SetObjectField(TEXT("Scale3D"), Scale3D);
+}
+
 FFallbackStructSerializer::FFallbackStructSerializer(UPropertySerializer* Serializer) : PropertySerializer(Serializer) {
 }
 
@@ -107,6 +296,16 @@ UPropertySerializer::UPropertySerializer() {
 
 	this->StructSerializers.Add(DateTimeStruct, MakeShared<FDateTimeSerializer>());
 	this->StructSerializers.Add(TimespanStruct, MakeShared<FTimespanSerializer>());
+
+	// Math and identity structs are most of the values in meshes, curves and materials
+	this->StructSerializers.Add(TBaseStructure<FVector>::Get(), MakeShared<TNativeStructSerializer<FVector>>());
+	this->StructSerializers.Add(TBaseStructure<FRotator>::Get(), MakeShared<TNativeStructSerializer<FRotator>>());
+	this->StructSerializers.Add(TBaseStructure<FQuat>::Get(), MakeShared<TNativeStructSerializer<FQuat>>());
+	this->StructSerializers.Add(TBaseStructure<FLinearColor>::Get(), MakeShared<TNativeStructSerializer<FLinearColor>>());
+	this->StructSerializers.Add(TBaseStructure<FColor>::Get(), MakeShared<TNativeStructSerializer<FColor>>());
+	this->StructSerializers.Add(TBaseStructure<FGuid>::Get(), MakeShared<TNativeStructSerializer<FGuid>>());
+	this->StructSerializers.Add(FRichCurveKey::StaticStruct(), MakeShared<TNativeStructSerializer<FRichCurveKey>>());
+	this->StructSerializers.Add(TBaseStructure<FTransform>::Get(), MakeShared<TNativeStructSerializer<FTransform>>());
 }
 
 void UPropertySerializer::DeserializePropertyValue(FProperty* Property, const TSharedRef<FJsonValue>& JsonValue, void* Value) {
@@ -314,7 +513,7 @@ void UPropertySerializer::DeserializePropertyValueInner(FProperty* Property, con
 		if (StructProperty->Struct == FGameplayTag::StaticStruct())
 		{
 			FGameplayTag* GameplayTagStr = static_cast<FGameplayTag*>(Value);
-			*GameplayTagStr = FGameplayTag::RequestGameplayTag(FName(*NewJsonValue->AsString()));
+			*GameplayTagStr = RequestGameplayTag(NewJsonValue->AsString());
 			
 			return;
 		}
@@ -324,14 +523,25 @@ void UPropertySerializer::DeserializePropertyValueInner(FProperty* Property, con
 		{
 			FGameplayTagContainer* GameplayTagContainerStr = static_cast<FGameplayTagContainer*>(Value);
 
-			auto GameplayTags = JsonValue->AsArray();
+			const TArray<TSharedPtr<FJsonValue>>& GameplayTagValues = JsonValue->AsArray();
 
-			for (TSharedPtr<FJsonValue> GameplayTagValue : GameplayTags)
+			TArray<FGameplayTag> Tags;
+			Tags.Reserve(GameplayTagValues.Num());
+
+			for (const TSharedPtr<FJsonValue>& GameplayTagValue : GameplayTagValues)
 			{
-				FString GameplayTagString = GameplayTagValue->AsString();
-				FGameplayTag GameplayTag = FGameplayTag::RequestGameplayTag(FName(*GameplayTagString));
-				
-				GameplayTagContainerStr->AddTag(GameplayTag);
+				const FGameplayTag GameplayTag = RequestGameplayTag(GameplayTagValue->AsString());
+
+				if (GameplayTag.IsValid()) {
+					Tags.AddUnique(GameplayTag);
+				}
+			}
+
+			// Parent tags are filled once for the whole container
+			if (GameplayTagContainerStr->IsEmpty()) {
+				*GameplayTagContainerStr = FGameplayTagContainer::CreateFromArray(Tags);
+			} else {
+				GameplayTagContainerStr->AppendTags(FGameplayTagContainer::CreateFromArray(Tags));
 			}
 			
 			return;
@@ -366,18 +576,15 @@ void UPropertySerializer::DeserializePropertyValueInner(FProperty* Property, con
 			}
 		}
 		
-		// JSON for FGuids are FStrings
+		// JSON for FGuids are FStrings, parsed straight into the property
 		FString OutString;
-		
-		if (JsonValue->TryGetString(OutString)) {
-			FGuid GUID = FGuid(OutString); // Create GUID from String
 
-			TSharedRef<FJsonObject> SharedObject = MakeShareable(new FJsonObject());
-			SharedObject->SetNumberField(TEXT("A"), GUID.A); SharedObject->SetNumberField(TEXT("B"), GUID.B);
-			SharedObject->SetNumberField(TEXT("C"), GUID.C); SharedObject->SetNumberField(TEXT("D"), GUID.D);
+		if (JsonValue->TryGetString(OutString)) {
+			if (StructProperty->Struct == TBaseStructure<FGuid>::Get()) {
+				*static_cast<FGuid*>(Value) = FGuid(OutString);
+			}
 
-			const TSharedRef<FJsonValue> NewValue = MakeShareable(new FJsonValueObject(SharedObject));
-			NewJsonValue = NewValue;
+			return;
 		}
 
 		// To serialize struct, we need it's type and value pointer, because struct value doesn't contain type information
@@ -456,11 +663,49 @@ void UPropertySerializer::DeserializePropertyValueInner(FProperty* Property, con
 	}
 }
 
+int32 FGameplayTagCacheScope::Depth = 0;
+
+FGameplayTagCacheScope::FGameplayTagCacheScope() {
+	check(IsInGameThread());
+	Depth++;
+}
+
+FGameplayTagCacheScope::~FGameplayTagCacheScope() {
+	if (--Depth == 0) {
+		UPropertySerializer::ClearGameplayTags();
+	}
+}
+
+bool FGameplayTagCacheScope::IsActive() {
+	return Depth > 0;
+}
+
+TMap<FString, FGameplayTag> UPropertySerializer::GameplayTags;
+
+FGameplayTag UPropertySerializer::RequestGameplayTag(const FString& TagName) {
+	if (const FGameplayTag* GameplayTag = GameplayTags.Find(TagName)) {
+		return *GameplayTag;
+	}
+
+	const FGameplayTag GameplayTag = FGameplayTag::RequestGameplayTag(FName(*TagName));
+
+	// Missing tags aren't kept, they may be added before they are requested again
+	if (GameplayTag.IsValid() && FGameplayTagCacheScope::IsActive()) {
+		GameplayTags.Add(TagName, GameplayTag);
+	}
+
+	return GameplayTag;
+}
+
 void UPropertySerializer::ClearCachedData()
 {
 	FailedProperties.Empty();
 }
 
+void UPropertySerializer::ClearGameplayTags() {
+	GameplayTags.Empty();
+}
+
 void UPropertySerializer::DisablePropertySerialization(UStruct* Struct, FName PropertyName) {
 	FProperty* Property = Struct->FindPropertyByName(PropertyName);
 	checkf(Property, TEXT("Cannot find Property %s in Struct %s"), *PropertyName.ToString(), *Struct->GetPathName());
@@ -496,6 +741,66 @@ bool UPropertySerializer::ShouldSerializeProperty(FProperty* Property) const {
 	return true;
 }
 
+bool UPropertySerializer::CanDeserializeOffGameThread(FProperty* Property) const {
+	TArray<UScriptStruct*> VisitedStructs;
+	return CanDeserializeOffGameThread(Property, VisitedStructs);
+}
+
+bool UPropertySerializer::CanDeserializeOffGameThread(FProperty* Property, TArray<UScriptStruct*>& VisitedStructs) const {
+	if (const FArrayProperty* ArrayProperty = CastField<const FArrayProperty>(Property)) {
+		return CanDeserializeOffGameThread(ArrayProperty->Inner, VisitedStructs);
+	}
+
+	if (const FSetProperty* SetProperty = CastField<const FSetProperty>(Property)) {
+		return CanDeserializeOffGameThread(SetProperty->ElementProp, VisitedStructs);
+	}
+
+	if (const FMapProperty* MapProperty = CastField<const FMapProperty>(Property)) {
+		return CanDeserializeOffGameThread(MapProperty->KeyProp, VisitedStructs) && CanDeserializeOffGameThread(MapProperty->ValueProp, VisitedStructs);
+	}
+
+	if (const FStructProperty* StructProperty = CastField<const FStructProperty>(Property)) {
+		return CanDeserializeOffGameThread(StructProperty->Struct, VisitedStructs);
+	}
+
+	// Objects load or import assets, and FText goes through the localization tables
+	return Property->IsA<FNumericProperty>() || Property->IsA<FBoolProperty>() || Property->IsA<FStrProperty>() || Property->IsA<FNameProperty>() || Property->IsA<FEnumProperty>();
+}
+
+bool UPropertySerializer::CanDeserializeOffGameThread(UScriptStruct* Struct) const {
+	TArray<UScriptStruct*> VisitedStructs;
+	return CanDeserializeOffGameThread(Struct, VisitedStructs);
+}
+
+bool UPropertySerializer::CanDeserializeOffGameThread(UScriptStruct* Struct, TArray<UScriptStruct*>& VisitedStructs) const {
+	// Gameplay tags go through the tag manager, soft object paths load their asset
+	if (Struct == FGameplayTag::StaticStruct() || Struct == FGameplayTagContainer::StaticStruct() || Struct->GetFName() == "SoftObjectPath") {
+		return false;
+	}
+
+	// Registered struct serializers only read plain values
+	if (StructSerializers.Contains(Struct)) {
+		return true;
+	}
+
+	if (VisitedStructs.Contains(Struct)) {
+		return false;
+	}
+
+	VisitedStructs.Push(Struct);
+
+	bool bCanDeserialize = true;
+	for (FProperty* StructMember = Struct->PropertyLink; StructMember && bCanDeserialize; StructMember = StructMember->PropertyLinkNext) {
+		if (ShouldSerializeProperty(StructMember)) {
+			bCanDeserialize = CanDeserializeOffGameThread(StructMember, VisitedStructs);
+		}
+	}
+
+	VisitedStructs.Pop();
+
+	return bCanDeserialize;
+}
+
 TSharedRef<FJsonValue> UPropertySerializer::SerializePropertyValue(FProperty* Property, const void* Value, TArray<int32>* OutReferencedSubobjects) {
 	// Serialize statically sized array properties
 	if (Property->ArrayDim != 1) {
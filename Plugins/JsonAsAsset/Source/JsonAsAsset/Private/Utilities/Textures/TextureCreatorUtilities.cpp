@@ -7,13 +7,15 @@
 #include "Engine/TextureCube.h"
 #include "Engine/VolumeTexture.h"
 #include "Factories/TextureRenderTargetFactoryNew.h"
-#include "nvimage/DirectDrawSurface.h"
-#include "nvimage/Image.h"
 #include "Utilities/EngineUtilities.h"
 #include "Utilities/MathUtilities.h"
-#include "Utilities/Textures/TextureDecode/TextureNVTT.h"
+#include "Utilities/Textures/TextureDecodeCache.h"
+#include "Utilities/Textures/TextureDecode/TextureBC.h"
+#include "Utilities/Textures/TextureDecode/TextureBlockDecode.h"
+#include "Utilities/Textures/TextureDecode/TextureETC.h"
+#include "Settings/JsonAsAssetSettings.h"
 
-bool FTextureCreatorUtilities::CreateTexture2D(UTexture*& OutTexture2D, TArray<uint8>& Data, const TSharedPtr<FJsonObject>& Properties) const {
+bool FTextureCreatorUtilities::CreateTexture2D(UTexture*& OutTexture2D, TArray<uint8>& Data, const TSharedPtr<FJsonObject>& Properties, const TArray<uint8>* DecodedData) const {
 	const TSharedPtr<FJsonObject> SubObjectProperties = Properties->GetObjectField(TEXT("Properties"));
 
 	UTexture2D* Texture2D = NewObject<UTexture2D>(OutermostPkg, UTexture2D::StaticClass(), *FileName, RF_Standalone | RF_Public);
@@ -48,11 +50,16 @@ bool FTextureCreatorUtilities::CreateTexture2D(UTexture*& OutTexture2D, TArray<u
 	FString PixelFormat;
 	if (Properties->TryGetStringField(TEXT("PixelFormat"), PixelFormat)) PlatformData->PixelFormat = static_cast<EPixelFormat>(Texture2D->GetPixelFormatEnum()->GetValueByNameString(PixelFormat));
 
-	int Size = SizeX * SizeY * (PlatformData->PixelFormat == PF_BC6H ? 16 : 4);
-	if (PlatformData->PixelFormat == PF_B8G8R8A8 || PlatformData->PixelFormat == PF_FloatRGBA || PlatformData->PixelFormat == PF_G16) Size = Data.Num();
+	const int Size = GetTexture2DDecodedSize(PlatformData->PixelFormat, SizeX, SizeY, Data.Num());
 	uint8* DecompressedData = static_cast<uint8*>(FMemory::Malloc(Size));
 
-	GetDecompressedTextureData(Data.GetData(), DecompressedData, SizeX, SizeY, SizeZ, Size, PlatformData->PixelFormat);
+	/* Already decoded by a batch import */
+	if (DecodedData != nullptr && DecodedData->Num() == Size) {
+		FMemory::Memcpy(DecompressedData, DecodedData->GetData(), Size);
+	} else if (!GetDecompressedTextureData(Data.GetData(), Data.Num(), DecompressedData, SizeX, SizeY, SizeZ, Size, PlatformData->PixelFormat)) {
+		FMemory::Free(DecompressedData);
+		return false;
+	}
 
 	ETextureSourceFormat Format = TSF_BGRA8;
 	if (Texture2D->CompressionSettings == TC_HDR) Format = TSF_RGBA16F;
@@ -144,7 +151,10 @@ bool FTextureCreatorUtilities::CreateVolumeTexture(UTexture*& OutVolumeTexture,
 
 	/* Decompression */
 	uint8* DecompressedData = static_cast<uint8*>(FMemory::Malloc(Size));
-	GetDecompressedTextureData(Data.GetData(), DecompressedData, SizeX, SizeY, SizeZ, Size, PlatformData->PixelFormat);
+	if (!GetDecompressedTextureData(Data.GetData(), Data.Num(), DecompressedData, SizeX, SizeY, SizeZ, Size, PlatformData->PixelFormat)) {
+		FMemory::Free(DecompressedData);
+		return false;
+	}
 
 	VolumeTexture->Source.Init(SizeX, SizeY, SizeZ, 1, TSF_BGRA8);
 
@@ -250,7 +260,80 @@ bool FTextureCreatorUtilities::DeserializeTexture(UTexture* Texture, const TShar
 	return false;
 }
 
-void FTextureCreatorUtilities::GetDecompressedTextureData(uint8* Data, uint8*& OutData, const int SizeX, const int SizeY, const int SizeZ, const int TotalSize, const EPixelFormat Format)
+EPixelFormat FTextureCreatorUtilities::GetPixelFormat(const TSharedPtr<FJsonObject>& Properties) {
+	FString PixelFormat;
+	if (!Properties->TryGetStringField(TEXT("PixelFormat"), PixelFormat)) return PF_Unknown;
+
+	const int64 Value = UTexture::GetPixelFormatEnum()->GetValueByNameString(PixelFormat);
+
+	return Value == INDEX_NONE ? PF_Unknown : static_cast<EPixelFormat>(Value);
+}
+
+int FTextureCreatorUtilities::GetTexture2DDecodedSize(const EPixelFormat Format, const int SizeX, const int SizeY, const int DataSize) {
+	/* Uncompressed formats are copied as is */
+	if (Format == PF_B8G8R8A8 || Format == PF_FloatRGBA || Format == PF_G16) return DataSize;
+
+	return SizeX * SizeY * (Format == PF_BC6H ? 16 : 4);
+}
+
+bool FTextureCreatorUtilities::DecodeTexture2D(TArray<uint8>& Data, const TSharedPtr<FJsonObject>& Properties, const EPixelFormat Format, TArray<uint8>& OutDecodedData) {
+	const int SizeX = Properties->GetNumberField(TEXT("SizeX"));
+	const int SizeY = Properties->GetNumberField(TEXT("SizeY"));
+
+	if (Format == PF_Unknown || SizeX <= 0 || SizeY <= 0 || Data.Num() == 0) return false;
+
+	const int Size = GetTexture2DDecodedSize(Format, SizeX, SizeY, Data.Num());
+	OutDecodedData.SetNumUninitialized(Size);
+
+	uint8* DecompressedData = OutDecodedData.GetData();
+	return GetDecompressedTextureData(Data.GetData(), Data.Num(), DecompressedData, SizeX, SizeY, 1, Size, Format);
+}
+
+/* Block compressed formats, the only ones worth keeping a decoded copy of */
+static bool IsBlockCompressedFormat(const EPixelFormat Format) {
+	switch (Format) {
+	case PF_BC7:
+	case PF_BC6H:
+	case PF_DXT1:
+	case PF_DXT3:
+	case PF_DXT5:
+	case PF_BC4:
+	case PF_BC5:
+	case PF_ETC2_RGB:
+	case PF_ETC2_RGBA:
+	case PF_ETC2_R11_EAC:
+	case PF_ETC2_RG11_EAC:
+		return true;
+
+	default:
+		return false;
+	}
+}
+
+bool FTextureCreatorUtilities::GetDecompressedTextureData(uint8* Data, const int DataSize, uint8*& OutData, const int SizeX, const int SizeY, const int SizeZ, const int TotalSize, const EPixelFormat Format)
+{
+	const UJsonAsAssetSettings* Settings = GetDefault<UJsonAsAssetSettings>();
+
+	// Uncompressed formats are a plain copy, caching them would only duplicate the mip
+	if (!Settings->AssetSettings.TextureImportSettings.bCacheDecodedTextures || !IsBlockCompressedFormat(Format)) {
+		return DecodeTextureData(Data, OutData, SizeX, SizeY, SizeZ, TotalSize, Format);
+	}
+
+	const FTextureDecodeKey Key = FTextureDecodeCache::MakeKey(Data, DataSize, SizeX, SizeY, SizeZ, Format);
+
+	if (FTextureDecodeCache::Find(Key, OutData, TotalSize)) {
+		return true;
+	}
+
+	if (!DecodeTextureData(Data, OutData, SizeX, SizeY, SizeZ, TotalSize, Format)) {
+		return false;
+	}
+
+	FTextureDecodeCache::Add(Key, OutData, TotalSize);
+	return true;
+}
+
+bool FTextureCreatorUtilities::DecodeTextureData(uint8* Data, uint8*& OutData, const int SizeX, const int SizeY, const int SizeZ, const int TotalSize, const EPixelFormat Format)
 {
 	// NOTE: Not all formats are supported, feel free to add
 	//       if needed. Formats may need other dependencies.
@@ -281,19 +364,42 @@ void FTextureCreatorUtilities::GetDecompressedTextureData(uint8* Data, uint8*& O
 	}
 	break;
 
-	case PF_DXT5: {
-		detexTexture Texture;
-		{
-			Texture.data = Data;
-			Texture.format = DETEX_TEXTURE_FORMAT_BC3;
-			Texture.width = SizeX;
-			Texture.height = SizeY;
-			Texture.width_in_blocks = SizeX / 4;
-			Texture.height_in_blocks = SizeY / 4;
-		}
+	// BC1-BC5: Desktop formats, decoded tile-parallel like NVTT
+	case PF_DXT1:
+		DecodeBlockRowsParallel(Data, OutData, SizeX, SizeY, SizeZ, 8, DecodeBlockRowBC1);
+	break;
 
-		detexDecompressTextureLinear(&Texture, OutData, DETEX_PIXEL_FORMAT_BGRA8);
-	}
+	case PF_DXT3:
+		DecodeBlockRowsParallel(Data, OutData, SizeX, SizeY, SizeZ, 16, DecodeBlockRowBC2);
+	break;
+
+	case PF_DXT5:
+		DecodeBlockRowsParallel(Data, OutData, SizeX, SizeY, SizeZ, 16, DecodeBlockRowBC3);
+	break;
+
+	case PF_BC4:
+		DecodeBlockRowsParallel(Data, OutData, SizeX, SizeY, SizeZ, 8, DecodeBlockRowBC4);
+	break;
+
+	case PF_BC5:
+		DecodeBlockRowsParallel(Data, OutData, SizeX, SizeY, SizeZ, 16, DecodeBlockRowBC5);
+	break;
+
+	// ETC2/EAC: Mobile formats, decoded tile-parallel
+	case PF_ETC2_RGB:
+		DecodeBlocksParallel(Data, OutData, SizeX, SizeY, SizeZ, 8, DecodeBlockETC2RGB);
+	break;
+
+	case PF_ETC2_RGBA:
+		DecodeBlocksParallel(Data, OutData, SizeX, SizeY, SizeZ, 16, DecodeBlockETC2RGBA);
+	break;
+
+	case PF_ETC2_R11_EAC:
+		DecodeBlocksParallel(Data, OutData, SizeX, SizeY, SizeZ, 8, DecodeBlockEACR11);
+	break;
+
+	case PF_ETC2_RG11_EAC:
+		DecodeBlocksParallel(Data, OutData, SizeX, SizeY, SizeZ, 16, DecodeBlockEACRG11);
 	break;
 
 	// Gray/Grey, not Green, typically actually uses a red format with replication of R to RGB
@@ -320,36 +426,10 @@ void FTextureCreatorUtilities::GetDecompressedTextureData(uint8* Data, uint8*& O
 	}
 	break;
 
-	default: {
-		nv::DDSHeader Header;
-		nv::Image Image;
-
-		uint FourCC;
-		switch (Format) {
-		case PF_BC4:
-			FourCC = FOURCC_ATI1;
-			break;
-		case PF_BC5:
-			FourCC = FOURCC_ATI2;
-			break;
-		case PF_DXT1:
-			FourCC = FOURCC_DXT1;
-			break;
-		case PF_DXT3:
-			FourCC = FOURCC_DXT3;
-			break;
-		default: FourCC = 0;
-		}
-
-		Header.setFourCC(FourCC);
-		Header.setWidth(SizeX);
-		Header.setHeight(SizeY);
-		Header.setDepth(SizeZ);
-		Header.setNormalFlag(Format == PF_BC5);
-		DecodeDDS(Data, SizeX, SizeY, SizeZ, Header, Image);
-
-		FMemory::Memcpy(OutData, Image.pixels(), TotalSize);
-	}
-	break;
+	default:
+		UE_LOG(LogJson, Error, TEXT("Unsupported pixel format %s, texture can't be decoded"), GetPixelFormatString(Format));
+		return false;
 	}
+
+	return true;
 }
@@ -0,0 +1,495 @@
+// Copyright JAA Contributors 2024-2025
+
+#include "TextureBC.h"
+
+#if PLATFORM_CPU_X86_FAMILY
+#include <emmintrin.h>
+#define JSONASASSET_BC_SSE2 1
+
+/* MSVC accepts AVX2 intrinsics anywhere, other compilers only when building for AVX2 */
+#if defined(__AVX2__) || (defined(_MSC_VER) && !defined(__clang__))
+#include <immintrin.h>
+#define JSONASASSET_BC_AVX2 1
+#else
+#define JSONASASSET_BC_AVX2 0
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#else
+#define JSONASASSET_BC_SSE2 0
+#define JSONASASSET_BC_AVX2 0
+#endif
+
+namespace
+{
+	FORCEINLINE uint32 LoadWord(const uint8* Data) {
+		uint32 Word;
+		FMemory::Memcpy(&Word, Data, sizeof(Word));
+
+		return Word;
+	}
+
+	/*
+	 * Every lane holds the same value of a different block, so a group of blocks
+	 * goes through the exact same steps as a single one. The scalar lanes keep
+	 * other platforms on the same code.
+	 */
+	struct FScalarLanes
+	{
+		typedef uint32 FInt;
+		typedef float FFloat;
+
+		static constexpr int Num = 1;
+
+		static FORCEINLINE FInt Load(const uint8* Blocks, const int Stride, const int Offset) { return LoadWord(Blocks + Offset); }
+		static FORCEINLINE FInt Set(const uint32 Value) { return Value; }
+
+		static FORCEINLINE FInt And(const FInt A, const FInt B) { return A & B; }
+		static FORCEINLINE FInt Or(const FInt A, const FInt B) { return A | B; }
+		static FORCEINLINE FInt Add(const FInt A, const FInt B) { return A + B; }
+		static FORCEINLINE FInt ShiftLeft(const FInt A, const int Count) { return A << Count; }
+		static FORCEINLINE FInt ShiftRight(const FInt A, const int Count) { return A >> Count; }
+
+		/* Multiplies of values below 65536, low and high 16 bits of the product */
+		static FORCEINLINE FInt MulLow16(const FInt A, const uint32 B) { return (A * B) & 0xFFFF; }
+		static FORCEINLINE FInt MulHigh16(const FInt A, const uint32 B) { return (A * B) >> 16; }
+
+		static FORCEINLINE FInt Greater(const FInt A, const FInt B) { return A > B ? ~0u : 0u; }
+		static FORCEINLINE FInt BitMask(const FInt A, const int Bit) { return 0u - ((A >> Bit) & 1); }
+		static FORCEINLINE FInt Select(const FInt Mask, const FInt A, const FInt B) { return (Mask & A) | (~Mask & B); }
+
+		static FORCEINLINE FFloat SetFloat(const float Value) { return Value; }
+		static FORCEINLINE FFloat ToFloat(const FInt A) { return static_cast<float>(A); }
+		static FORCEINLINE FInt Truncate(const FFloat A) { return static_cast<uint32>(static_cast<int>(A)); }
+		static FORCEINLINE FFloat AddFloat(const FFloat A, const FFloat B) { return A + B; }
+		static FORCEINLINE FFloat SubFloat(const FFloat A, const FFloat B) { return A - B; }
+		static FORCEINLINE FFloat MulFloat(const FFloat A, const FFloat B) { return A * B; }
+		static FORCEINLINE FFloat DivFloat(const FFloat A, const FFloat B) { return A / B; }
+		static FORCEINLINE FFloat ClampFloat(const FFloat A, const FFloat Min, const FFloat Max) { return A < Min ? Min : A > Max ? Max : A; }
+		static FORCEINLINE FFloat SqrtIfPositive(const FFloat A) { return A > 0.0f ? FMath::Sqrt(A) : 0.0f; }
+
+		static FORCEINLINE void Store(const FInt* Pixels, uint8* OutPixels, const int64 RowPitch) {
+			for (int Row = 0; Row < 4; Row++) {
+				FMemory::Memcpy(OutPixels + Row * RowPitch, Pixels + Row * 4, 16);
+			}
+		}
+	};
+
+#if JSONASASSET_BC_SSE2
+	FORCEINLINE void StoreTransposed(const __m128i* Pixels, uint8* OutPixels, const int64 RowPitch) {
+		for (int Row = 0; Row < 4; Row++) {
+			const __m128i* Source = Pixels + Row * 4;
+
+			/* Pixel-major to block-major, each block gets one row of four pixels */
+			const __m128i Low01 = _mm_unpacklo_epi32(Source[0], Source[1]);
+			const __m128i Low23 = _mm_unpacklo_epi32(Source[2], Source[3]);
+			const __m128i High01 = _mm_unpackhi_epi32(Source[0], Source[1]);
+			const __m128i High23 = _mm_unpackhi_epi32(Source[2], Source[3]);
+
+			uint8* Out = OutPixels + Row * RowPitch;
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Out + 0), _mm_unpacklo_epi64(Low01, Low23));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Out + 16), _mm_unpackhi_epi64(Low01, Low23));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Out + 32), _mm_unpacklo_epi64(High01, High23));
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(Out + 48), _mm_unpackhi_epi64(High01, High23));
+		}
+	}
+
+	struct FSSE2Lanes
+	{
+		typedef __m128i FInt;
+		typedef __m128 FFloat;
+
+		static constexpr int Num = 4;
+
+		static FORCEINLINE FInt Load(const uint8* Blocks, const int Stride, const int Offset) {
+			const uint8* Data = Blocks + Offset;
+
+			return _mm_setr_epi32(LoadWord(Data), LoadWord(Data + Stride), LoadWord(Data + Stride * 2), LoadWord(Data + Stride * 3));
+		}
+
+		static FORCEINLINE FInt Set(const uint32 Value) { return _mm_set1_epi32(static_cast<int>(Value)); }
+
+		static FORCEINLINE FInt And(const FInt A, const FInt B) { return _mm_and_si128(A, B); }
+		static FORCEINLINE FInt Or(const FInt A, const FInt B) { return _mm_or_si128(A, B); }
+		static FORCEINLINE FInt Add(const FInt A, const FInt B) { return _mm_add_epi32(A, B); }
+		static FORCEINLINE FInt ShiftLeft(const FInt A, const int Count) { return _mm_sll_epi32(A, _mm_cvtsi32_si128(Count)); }
+		static FORCEINLINE FInt ShiftRight(const FInt A, const int Count) { return _mm_srl_epi32(A, _mm_cvtsi32_si128(Count)); }
+
+		static FORCEINLINE FInt MulLow16(const FInt A, const uint32 B) { return _mm_mullo_epi16(A, Set(B)); }
+		static FORCEINLINE FInt MulHigh16(const FInt A, const uint32 B) { return _mm_mulhi_epu16(A, Set(B)); }
+
+		static FORCEINLINE FInt Greater(const FInt A, const FInt B) { return _mm_cmpgt_epi32(A, B); }
+		static FORCEINLINE FInt BitMask(const FInt A, const int Bit) { return _mm_srai_epi32(ShiftLeft(A, 31 - Bit), 31); }
+		static FORCEINLINE FInt Select(const FInt Mask, const FInt A, const FInt B) { return _mm_or_si128(_mm_and_si128(Mask, A), _mm_andnot_si128(Mask, B)); }
+
+		static FORCEINLINE FFloat SetFloat(const float Value) { return _mm_set1_ps(Value); }
+		static FORCEINLINE FFloat ToFloat(const FInt A) { return _mm_cvtepi32_ps(A); }
+		static FORCEINLINE FInt Truncate(const FFloat A) { return _mm_cvttps_epi32(A); }
+		static FORCEINLINE FFloat AddFloat(const FFloat A, const FFloat B) { return _mm_add_ps(A, B); }
+		static FORCEINLINE FFloat SubFloat(const FFloat A, const FFloat B) { return _mm_sub_ps(A, B); }
+		static FORCEINLINE FFloat MulFloat(const FFloat A, const FFloat B) { return _mm_mul_ps(A, B); }
+		static FORCEINLINE FFloat DivFloat(const FFloat A, const FFloat B) { return _mm_div_ps(A, B); }
+		static FORCEINLINE FFloat ClampFloat(const FFloat A, const FFloat Min, const FFloat Max) { return _mm_min_ps(_mm_max_ps(A, Min), Max); }
+		static FORCEINLINE FFloat SqrtIfPositive(const FFloat A) { return _mm_and_ps(_mm_cmpgt_ps(A, _mm_setzero_ps()), _mm_sqrt_ps(A)); }
+
+		static FORCEINLINE void Store(const FInt* Pixels, uint8* OutPixels, const int64 RowPitch) {
+			StoreTransposed(Pixels, OutPixels, RowPitch);
+		}
+	};
+#endif
+
+#if JSONASASSET_BC_AVX2
+	struct FAVX2Lanes
+	{
+		typedef __m256i FInt;
+		typedef __m256 FFloat;
+
+		static constexpr int Num = 8;
+
+		static FORCEINLINE FInt Load(const uint8* Blocks, const int Stride, const int Offset) {
+			const uint8* Data = Blocks + Offset;
+
+			return _mm256_setr_epi32(
+				LoadWord(Data), LoadWord(Data + Stride), LoadWord(Data + Stride * 2), LoadWord(Data + Stride * 3),
+				LoadWord(Data + Stride * 4), LoadWord(Data + Stride * 5), LoadWord(Data + Stride * 6), LoadWord(Data + Stride * 7));
+		}
+
+		static FORCEINLINE FInt Set(const uint32 Value) { return _mm256_set1_epi32(static_cast<int>(Value)); }
+
+		static FORCEINLINE FInt And(const FInt A, const FInt B) { return _mm256_and_si256(A, B); }
+		static FORCEINLINE FInt Or(const FInt A, const FInt B) { return _mm256_or_si256(A, B); }
+		static FORCEINLINE FInt Add(const FInt A, const FInt B) { return _mm256_add_epi32(A, B); }
+		static FORCEINLINE FInt ShiftLeft(const FInt A, const int Count) { return _mm256_sll_epi32(A, _mm_cvtsi32_si128(Count)); }
+		static FORCEINLINE FInt ShiftRight(const FInt A, const int Count) { return _mm256_srl_epi32(A, _mm_cvtsi32_si128(Count)); }
+
+		static FORCEINLINE FInt MulLow16(const FInt A, const uint32 B) { return _mm256_mullo_epi16(A, Set(B)); }
+		static FORCEINLINE FInt MulHigh16(const FInt A, const uint32 B) { return _mm256_mulhi_epu16(A, Set(B)); }
+
+		static FORCEINLINE FInt Greater(const FInt A, const FInt B) { return _mm256_cmpgt_epi32(A, B); }
+		static FORCEINLINE FInt BitMask(const FInt A, const int Bit) { return _mm256_srai_epi32(ShiftLeft(A, 31 - Bit), 31); }
+		static FORCEINLINE FInt Select(const FInt Mask, const FInt A, const FInt B) { return _mm256_blendv_epi8(B, A, Mask); }
+
+		static FORCEINLINE FFloat SetFloat(const float Value) { return _mm256_set1_ps(Value); }
+		static FORCEINLINE FFloat ToFloat(const FInt A) { return _mm256_cvtepi32_ps(A); }
+		static FORCEINLINE FInt Truncate(const FFloat A) { return _mm256_cvttps_epi32(A); }
+		static FORCEINLINE FFloat AddFloat(const FFloat A, const FFloat B) { return _mm256_add_ps(A, B); }
+		static FORCEINLINE FFloat SubFloat(const FFloat A, const FFloat B) { return _mm256_sub_ps(A, B); }
+		static FORCEINLINE FFloat MulFloat(const FFloat A, const FFloat B) { return _mm256_mul_ps(A, B); }
+		static FORCEINLINE FFloat DivFloat(const FFloat A, const FFloat B) { return _mm256_div_ps(A, B); }
+		static FORCEINLINE FFloat ClampFloat(const FFloat A, const FFloat Min, const FFloat Max) { return _mm256_min_ps(_mm256_max_ps(A, Min), Max); }
+		static FORCEINLINE FFloat SqrtIfPositive(const FFloat A) { return _mm256_and_ps(_mm256_cmp_ps(A, _mm256_setzero_ps(), _CMP_GT_OQ), _mm256_sqrt_ps(A)); }
+
+		/* Unpacks stay inside 128 bit halves, so the low half holds blocks 0-3 and the high half blocks 4-7 */
+		static FORCEINLINE void Store(const FInt* Pixels, uint8* OutPixels, const int64 RowPitch) {
+			__m128i Low[16];
+			__m128i High[16];
+
+			for (int Pixel = 0; Pixel < 16; Pixel++) {
+				Low[Pixel] = _mm256_castsi256_si128(Pixels[Pixel]);
+				High[Pixel] = _mm256_extracti128_si256(Pixels[Pixel], 1);
+			}
+
+			StoreTransposed(Low, OutPixels, RowPitch);
+			StoreTransposed(High, OutPixels + 64, RowPitch);
+		}
+	};
+
+	bool DetectAVX2() {
+#if defined(__AVX2__)
+		return true;
+#else
+		int Info[4];
+		__cpuid(Info, 0);
+		if (Info[0] < 7) {
+			return false;
+		}
+
+		/* OSXSAVE and AVX, then make sure the OS saves the YMM registers */
+		__cpuid(Info, 1);
+		if ((Info[2] & (1 << 27)) == 0 || (Info[2] & (1 << 28)) == 0 || (_xgetbv(0) & 6) != 6) {
+			return false;
+		}
+
+		__cpuidex(Info, 7, 0);
+		return (Info[1] & (1 << 5)) != 0;
+#endif
+	}
+
+	bool HasAVX2() {
+		static const bool bHasAVX2 = DetectAVX2();
+		return bHasAVX2;
+	}
+#endif
+
+	/*
+	 * Four BGRA8 colors from two 5-6-5 endpoints, expanded with bit replication.
+	 * Color blocks of BC2 and BC3 always use four colors, whatever the endpoint order
+	 */
+	template <typename V, bool bForceFourColors>
+	FORCEINLINE void DecodeColor(const uint8* Blocks, const int Stride, const int Offset, typename V::FInt* OutPixels) {
+		typedef typename V::FInt FInt;
+
+		const FInt Colors = V::Load(Blocks, Stride, Offset);
+		const FInt Indices = V::Load(Blocks, Stride, Offset + 4);
+
+		const FInt Color0 = V::And(Colors, V::Set(0xFFFF));
+		const FInt Color1 = V::ShiftRight(Colors, 16);
+
+		const auto Expand = [](const FInt Color, const int Shift, const uint32 Mask, const int Bits) {
+			const FInt Value = V::And(V::ShiftRight(Color, Shift), V::Set(Mask));
+			return V::Or(V::ShiftLeft(Value, 8 - Bits), V::ShiftRight(Value, 2 * Bits - 8));
+		};
+
+		const FInt B0 = Expand(Color0, 0, 0x1F, 5);
+		const FInt G0 = Expand(Color0, 5, 0x3F, 6);
+		const FInt R0 = Expand(Color0, 11, 0x1F, 5);
+		const FInt B1 = Expand(Color1, 0, 0x1F, 5);
+		const FInt G1 = Expand(Color1, 5, 0x3F, 6);
+		const FInt R1 = Expand(Color1, 11, 0x1F, 5);
+
+		const auto Pack = [](const FInt B, const FInt G, const FInt R) {
+			return V::Or(V::Or(B, V::ShiftLeft(G, 8)), V::ShiftLeft(R, 16));
+		};
+
+		/* Division by three of anything up to 765 is exact as (x * 21846) >> 16 */
+		const auto TwoThirds = [](const FInt A, const FInt B) {
+			return V::MulHigh16(V::Add(V::Add(A, A), B), 21846);
+		};
+
+		const auto Half = [](const FInt A, const FInt B) {
+			return V::ShiftRight(V::Add(A, B), 1);
+		};
+
+		const FInt Alpha = V::Set(0xFF000000);
+		const FInt FourColors = bForceFourColors ? V::Set(~0u) : V::Greater(Color0, Color1);
+
+		const FInt Palette0 = V::Or(Pack(B0, G0, R0), Alpha);
+		const FInt Palette1 = V::Or(Pack(B1, G1, R1), Alpha);
+
+		/* Three color blocks use the midpoint and transparent black */
+		const FInt Palette2 = V::Or(V::Select(FourColors,
+			Pack(TwoThirds(B0, B1), TwoThirds(G0, G1), TwoThirds(R0, R1)),
+			Pack(Half(B0, B1), Half(G0, G1), Half(R0, R1))), Alpha);
+		const FInt Palette3 = V::And(FourColors,
+			V::Or(Pack(TwoThirds(B1, B0), TwoThirds(G1, G0), TwoThirds(R1, R0)), Alpha));
+
+		for (int Pixel = 0; Pixel < 16; Pixel++) {
+			const FInt Index = V::ShiftRight(Indices, Pixel * 2);
+			const FInt Bit0 = V::BitMask(Index, 0);
+			const FInt Bit1 = V::BitMask(Index, 1);
+
+			OutPixels[Pixel] = V::Select(Bit1, V::Select(Bit0, Palette3, Palette2), V::Select(Bit0, Palette1, Palette0));
+		}
+	}
+
+	/* Eight or six interpolated values plus 3 bit indices, used by BC3 alpha, BC4 and BC5 */
+	template <typename V>
+	FORCEINLINE void DecodeChannel(const uint8* Blocks, const int Stride, const int Offset, typename V::FInt* OutValues) {
+		typedef typename V::FInt FInt;
+
+		const FInt Endpoints = V::Load(Blocks, Stride, Offset);
+		const FInt Value0 = V::And(Endpoints, V::Set(0xFF));
+		const FInt Value1 = V::And(V::ShiftRight(Endpoints, 8), V::Set(0xFF));
+
+		/* 48 index bits, pixels 0-9 come from the low word and the rest from bits 16-47 */
+		const FInt IndicesLow = V::Load(Blocks, Stride, Offset + 2);
+		const FInt IndicesHigh = V::Load(Blocks, Stride, Offset + 4);
+
+		const FInt EightValues = V::Greater(Value0, Value1);
+
+		/* Divisions by 7 and 5 are exact as multiplies below 1786 and 1276 */
+		FInt Palette[8];
+		Palette[0] = Value0;
+		Palette[1] = Value1;
+
+		for (int Index = 2; Index < 8; Index++) {
+			const FInt Eight = V::MulHigh16(V::Add(V::MulLow16(Value0, 8 - Index), V::MulLow16(Value1, Index - 1)), 9363);
+			const FInt Six = Index < 6
+				? V::MulHigh16(V::Add(V::MulLow16(Value0, 6 - Index), V::MulLow16(Value1, Index - 1)), 13108)
+				: V::Set(Index == 6 ? 0 : 255);
+
+			Palette[Index] = V::Select(EightValues, Eight, Six);
+		}
+
+		for (int Pixel = 0; Pixel < 16; Pixel++) {
+			const FInt Index = Pixel < 10 ? V::ShiftRight(IndicesLow, Pixel * 3) : V::ShiftRight(IndicesHigh, Pixel * 3 - 16);
+			const FInt Bit0 = V::BitMask(Index, 0);
+			const FInt Bit1 = V::BitMask(Index, 1);
+			const FInt Bit2 = V::BitMask(Index, 2);
+
+			const FInt Low = V::Select(Bit1, V::Select(Bit0, Palette[3], Palette[2]), V::Select(Bit0, Palette[1], Palette[0]));
+			const FInt High = V::Select(Bit1, V::Select(Bit0, Palette[7], Palette[6]), V::Select(Bit0, Palette[5], Palette[4]));
+
+			OutValues[Pixel] = V::Select(Bit2, High, Low);
+		}
+	}
+
+	struct FBC1
+	{
+		static constexpr int BlockBytes = 8;
+
+		template <typename V>
+		static FORCEINLINE void Decode(const uint8* Blocks, typename V::FInt* OutPixels) {
+			DecodeColor<V, false>(Blocks, BlockBytes, 0, OutPixels);
+		}
+	};
+
+	struct FBC2
+	{
+		static constexpr int BlockBytes = 16;
+
+		template <typename V>
+		static FORCEINLINE void Decode(const uint8* Blocks, typename V::FInt* OutPixels) {
+			typedef typename V::FInt FInt;
+
+			DecodeColor<V, true>(Blocks, BlockBytes, 8, OutPixels);
+
+			/* Explicit 4 bit alpha */
+			const FInt AlphaLow = V::Load(Blocks, BlockBytes, 0);
+			const FInt AlphaHigh = V::Load(Blocks, BlockBytes, 4);
+
+			for (int Pixel = 0; Pixel < 16; Pixel++) {
+				const FInt Alpha = V::And(V::ShiftRight(Pixel < 8 ? AlphaLow : AlphaHigh, (Pixel & 7) * 4), V::Set(0xF));
+				const FInt Color = V::And(OutPixels[Pixel], V::Set(0x00FFFFFF));
+
+				OutPixels[Pixel] = V::Or(Color, V::Or(V::ShiftLeft(Alpha, 24), V::ShiftLeft(Alpha, 28)));
+			}
+		}
+	};
+
+	struct FBC3
+	{
+		static constexpr int BlockBytes = 16;
+
+		template <typename V>
+		static FORCEINLINE void Decode(const uint8* Blocks, typename V::FInt* OutPixels) {
+			typedef typename V::FInt FInt;
+
+			DecodeColor<V, true>(Blocks, BlockBytes, 8, OutPixels);
+
+			FInt Alpha[16];
+			DecodeChannel<V>(Blocks, BlockBytes, 0, Alpha);
+
+			for (int Pixel = 0; Pixel < 16; Pixel++) {
+				OutPixels[Pixel] = V::Or(V::And(OutPixels[Pixel], V::Set(0x00FFFFFF)), V::ShiftLeft(Alpha[Pixel], 24));
+			}
+		}
+	};
+
+	struct FBC4
+	{
+		static constexpr int BlockBytes = 8;
+
+		template <typename V>
+		static FORCEINLINE void Decode(const uint8* Blocks, typename V::FInt* OutPixels) {
+			typedef typename V::FInt FInt;
+
+			FInt Gray[16];
+			DecodeChannel<V>(Blocks, BlockBytes, 0, Gray);
+
+			for (int Pixel = 0; Pixel < 16; Pixel++) {
+				OutPixels[Pixel] = V::Or(V::MulLow16(Gray[Pixel], 0x0101), V::Or(V::ShiftLeft(Gray[Pixel], 16), V::Set(0xFF000000)));
+			}
+		}
+	};
+
+	struct FBC5
+	{
+		static constexpr int BlockBytes = 16;
+
+		template <typename V>
+		static FORCEINLINE void Decode(const uint8* Blocks, typename V::FInt* OutPixels) {
+			typedef typename V::FInt FInt;
+			typedef typename V::FFloat FFloat;
+
+			FInt X[16];
+			FInt Y[16];
+			DecodeChannel<V>(Blocks, BlockBytes, 0, X);
+			DecodeChannel<V>(Blocks, BlockBytes, 8, Y);
+
+			const FFloat One = V::SetFloat(1.0f);
+			const FFloat Two = V::SetFloat(2.0f);
+			const FFloat Max = V::SetFloat(255.0f);
+
+			/* Same operations in the same order as buildNormal, so the result is bit exact */
+			for (int Pixel = 0; Pixel < 16; Pixel++) {
+				const FFloat NormalX = V::SubFloat(V::MulFloat(Two, V::DivFloat(V::ToFloat(X[Pixel]), Max)), One);
+				const FFloat NormalY = V::SubFloat(V::MulFloat(Two, V::DivFloat(V::ToFloat(Y[Pixel]), Max)), One);
+				const FFloat Remainder = V::SubFloat(V::SubFloat(One, V::MulFloat(NormalX, NormalX)), V::MulFloat(NormalY, NormalY));
+				const FFloat NormalZ = V::SqrtIfPositive(Remainder);
+
+				const FFloat Z = V::DivFloat(V::MulFloat(Max, V::AddFloat(NormalZ, One)), Two);
+				const FInt Blue = V::Truncate(V::ClampFloat(Z, V::SetFloat(0.0f), Max));
+
+				OutPixels[Pixel] = V::Or(V::Or(Blue, V::ShiftLeft(Y[Pixel], 8)), V::Or(V::ShiftLeft(X[Pixel], 16), V::Set(0xFF000000)));
+			}
+		}
+	};
+
+	template <typename V, typename FFormat>
+	void DecodeRow(const uint8* Blocks, const int NumBlocks, uint8* OutPixels, const int64 RowPitch) {
+		typename V::FInt Pixels[16];
+
+		int Block = 0;
+		for (; Block + V::Num <= NumBlocks; Block += V::Num) {
+			FFormat::template Decode<V>(Blocks + Block * FFormat::BlockBytes, Pixels);
+			V::Store(Pixels, OutPixels + Block * 16, RowPitch);
+		}
+
+		if (Block == NumBlocks) {
+			return;
+		}
+
+		/* Pad the last group with empty blocks and keep only the real ones */
+		const int Remaining = NumBlocks - Block;
+
+		uint8 Padded[V::Num * FFormat::BlockBytes] = {};
+		uint8 Scratch[V::Num * 16 * 4];
+		FMemory::Memcpy(Padded, Blocks + Block * FFormat::BlockBytes, Remaining * FFormat::BlockBytes);
+
+		FFormat::template Decode<V>(Padded, Pixels);
+		V::Store(Pixels, Scratch, V::Num * 16);
+
+		for (int Row = 0; Row < 4; Row++) {
+			FMemory::Memcpy(OutPixels + Block * 16 + Row * RowPitch, Scratch + Row * V::Num * 16, Remaining * 16);
+		}
+	}
+
+	template <typename FFormat>
+	void DispatchRow(const uint8* Blocks, const int NumBlocks, uint8* OutPixels, const int64 RowPitch) {
+#if JSONASASSET_BC_AVX2
+		if (HasAVX2()) {
+			DecodeRow<FAVX2Lanes, FFormat>(Blocks, NumBlocks, OutPixels, RowPitch);
+			return;
+		}
+#endif
+
+#if JSONASASSET_BC_SSE2
+		DecodeRow<FSSE2Lanes, FFormat>(Blocks, NumBlocks, OutPixels, RowPitch);
+#else
+		DecodeRow<FScalarLanes, FFormat>(Blocks, NumBlocks, OutPixels, RowPitch);
+#endif
+	}
+}
+
+void DecodeBlockRowBC1(const uint8* Blocks, const int NumBlocks, uint8* OutPixels, const int64 RowPitch) {
+	DispatchRow<FBC1>(Blocks, NumBlocks, OutPixels, RowPitch);
+}
+
+void DecodeBlockRowBC2(const uint8* Blocks, const int NumBlocks, uint8* OutPixels, const int64 RowPitch) {
+	DispatchRow<FBC2>(Blocks, NumBlocks, OutPixels, RowPitch);
+}
+
+void DecodeBlockRowBC3(const uint8* Blocks, const int NumBlocks, uint8* OutPixels, const int64 RowPitch) {
+	DispatchRow<FBC3>(Blocks, NumBlocks, OutPixels, RowPitch);
+}
+
+void DecodeBlockRowBC4(const uint8* Blocks, const int NumBlocks, uint8* OutPixels, const int64 RowPitch) {
+	DispatchRow<FBC4>(Blocks, NumBlocks, OutPixels, RowPitch);
+}
+
+void DecodeBlockRowBC5(const uint8* Blocks, const int NumBlocks, uint8* OutPixels, const int64 RowPitch) {
+	DispatchRow<FBC5>(Blocks, NumBlocks, OutPixels, RowPitch);
+}
@@ -0,0 +1,22 @@
+// Copyright JAA Contributors 2024-2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/*
+ * BC1-BC5 row decoders, each one matches the FDecodeBlockRowFunction signature
+ * of the tile-parallel driver and writes BGRA8 the same way NVTT does.
+ *
+ * Blocks are decoded four at a time with SSE2, or eight at a time with AVX2
+ * when the CPU supports it.
+ */
+void DecodeBlockRowBC1(const uint8* Blocks, int NumBlocks, uint8* OutPixels, int64 RowPitch);
+void DecodeBlockRowBC2(const uint8* Blocks, int NumBlocks, uint8* OutPixels, int64 RowPitch);
+void DecodeBlockRowBC3(const uint8* Blocks, int NumBlocks, uint8* OutPixels, int64 RowPitch);
+
+/* Single channel, replicated to gray */
+void DecodeBlockRowBC4(const uint8* Blocks, int NumBlocks, uint8* OutPixels, int64 RowPitch);
+
+/* Two channel normal map, Z is rebuilt like NVTT buildNormal */
+void DecodeBlockRowBC5(const uint8* Blocks, int NumBlocks, uint8* OutPixels, int64 RowPitch);
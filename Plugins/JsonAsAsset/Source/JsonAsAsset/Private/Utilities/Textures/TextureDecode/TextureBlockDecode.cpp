@@ -0,0 +1,74 @@
+// Copyright JAA Contributors 2024-2025
+
+#include "TextureBlockDecode.h"
+
+#include "Async/ParallelFor.h"
+
+void DecodeBlocksParallel(const uint8* Data, uint8* OutData, const int SizeX, const int SizeY, const int SizeZ, const int BlockBytes, const FDecodeBlockFunction DecodeBlock) {
+	const int BlocksX = (SizeX + 3) / 4;
+	const int BlocksY = (SizeY + 3) / 4;
+	const int Slices = FMath::Max(SizeZ, 1);
+
+	const int64 SliceBlockBytes = static_cast<int64>(BlocksX) * BlocksY * BlockBytes;
+	const int64 SlicePixelBytes = static_cast<int64>(SizeX) * SizeY * 4;
+	const int64 RowPitch = static_cast<int64>(SizeX) * 4;
+
+	/* One task per row of blocks, every row writes to its own part of the output */
+	ParallelFor(BlocksY * Slices, [&](const int32 RowIndex) {
+		const int Slice = RowIndex / BlocksY;
+		const int BlockY = RowIndex % BlocksY;
+		const int Rows = FMath::Min(4, SizeY - BlockY * 4);
+
+		const uint8* Block = Data + Slice * SliceBlockBytes + static_cast<int64>(BlockY) * BlocksX * BlockBytes;
+		uint8* RowOut = OutData + Slice * SlicePixelBytes + BlockY * 4 * RowPitch;
+
+		alignas(16) uint8 Pixels[16 * 4];
+
+		for (int BlockX = 0; BlockX < BlocksX; BlockX++, Block += BlockBytes) {
+			if (!DecodeBlock(Block, Pixels)) {
+				FMemory::Memzero(Pixels, sizeof(Pixels));
+			}
+
+			const int Columns = FMath::Min(4, SizeX - BlockX * 4);
+			uint8* Dest = RowOut + BlockX * 4 * 4;
+
+			for (int Row = 0; Row < Rows; Row++) {
+				FMemory::Memcpy(Dest + Row * RowPitch, Pixels + Row * 16, Columns * 4);
+			}
+		}
+	});
+}
+
+void DecodeBlockRowsParallel(const uint8* Data, uint8* OutData, const int SizeX, const int SizeY, const int SizeZ, const int BlockBytes, const FDecodeBlockRowFunction DecodeRow) {
+	const int BlocksX = (SizeX + 3) / 4;
+	const int BlocksY = (SizeY + 3) / 4;
+	const int Slices = FMath::Max(SizeZ, 1);
+
+	const int64 SliceBlockBytes = static_cast<int64>(BlocksX) * BlocksY * BlockBytes;
+	const int64 SlicePixelBytes = static_cast<int64>(SizeX) * SizeY * 4;
+	const int64 RowPitch = static_cast<int64>(SizeX) * 4;
+	const int64 ScratchPitch = static_cast<int64>(BlocksX) * 4 * 4;
+
+	ParallelFor(BlocksY * Slices, [&](const int32 RowIndex) {
+		const int Slice = RowIndex / BlocksY;
+		const int BlockY = RowIndex % BlocksY;
+		const int Rows = FMath::Min(4, SizeY - BlockY * 4);
+
+		const uint8* Blocks = Data + Slice * SliceBlockBytes + static_cast<int64>(BlockY) * BlocksX * BlockBytes;
+		uint8* RowOut = OutData + Slice * SlicePixelBytes + BlockY * 4 * RowPitch;
+
+		/* Whole blocks go straight to the output */
+		if (Rows == 4 && SizeX % 4 == 0) {
+			DecodeRow(Blocks, BlocksX, RowOut, RowPitch);
+			return;
+		}
+
+		TArray<uint8> Scratch;
+		Scratch.SetNumUninitialized(ScratchPitch * 4);
+		DecodeRow(Blocks, BlocksX, Scratch.GetData(), ScratchPitch);
+
+		for (int Row = 0; Row < Rows; Row++) {
+			FMemory::Memcpy(RowOut + Row * RowPitch, Scratch.GetData() + Row * ScratchPitch, RowPitch);
+		}
+	});
+}
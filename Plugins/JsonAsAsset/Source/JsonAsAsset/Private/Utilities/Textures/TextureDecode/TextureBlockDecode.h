@@ -0,0 +1,25 @@
+// Copyright JAA Contributors 2024-2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/* Decodes a single 4x4 block into 16 row-major BGRA8 pixels, returns false on an invalid block */
+typedef bool (*FDecodeBlockFunction)(const uint8* Block, uint8* OutPixels);
+
+/*
+ * Tile-parallel block decoder. Rows of blocks are spread over the task graph and
+ * each block is written straight into the linear BGRA8 output, clipping partial
+ * blocks on the right and bottom edges. Invalid blocks are left black.
+ */
+void DecodeBlocksParallel(const uint8* Data, uint8* OutData, int SizeX, int SizeY, int SizeZ, int BlockBytes, FDecodeBlockFunction DecodeBlock);
+
+/* Decodes a run of NumBlocks blocks into four full pixel rows, RowPitch bytes apart */
+typedef void (*FDecodeBlockRowFunction)(const uint8* Blocks, int NumBlocks, uint8* OutPixels, int64 RowPitch);
+
+/*
+ * Same as DecodeBlocksParallel, but hands a whole row of blocks to the decoder
+ * so it can work on several blocks at once. Rows that are clipped by the edges
+ * of the texture are decoded into scratch memory first.
+ */
+void DecodeBlockRowsParallel(const uint8* Data, uint8* OutData, int SizeX, int SizeY, int SizeZ, int BlockBytes, FDecodeBlockRowFunction DecodeRow);
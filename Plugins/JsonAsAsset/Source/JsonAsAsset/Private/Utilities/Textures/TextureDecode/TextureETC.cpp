@@ -0,0 +1,260 @@
+// Copyright JAA Contributors 2024-2025
+
+#include "TextureETC.h"
+
+#include "detex.h"
+
+#if PLATFORM_CPU_X86_FAMILY
+#include <emmintrin.h>
+#define JSONASASSET_ETC_SSE2 1
+#else
+#define JSONASASSET_ETC_SSE2 0
+#endif
+
+namespace
+{
+	/* Same tables as Detex (decompress-etc.cpp / decompress-eac.cpp) */
+	const int16 ETCModifierTable[8][4] = {
+		{ 2, 8, -2, -8 },
+		{ 5, 17, -5, -17 },
+		{ 9, 29, -9, -29 },
+		{ 13, 42, -13, -42 },
+		{ 18, 60, -18, -60 },
+		{ 24, 80, -24, -80 },
+		{ 33, 106, -33, -106 },
+		{ 47, 183, -47, -183 }
+	};
+
+	const int8 EACModifierTable[16][8] = {
+		{ -3, -6, -9, -15, 2, 5, 8, 14 },
+		{ -3, -7, -10, -13, 2, 6, 9, 12 },
+		{ -2, -5, -8, -13, 1, 4, 7, 12 },
+		{ -2, -4, -6, -13, 1, 3, 5, 12 },
+		{ -3, -6, -8, -12, 2, 5, 7, 11 },
+		{ -3, -7, -9, -11, 2, 6, 8, 10 },
+		{ -4, -7, -8, -11, 3, 6, 7, 10 },
+		{ -3, -5, -8, -11, 2, 4, 7, 10 },
+		{ -2, -6, -8, -10, 1, 5, 7, 9 },
+		{ -2, -5, -8, -10, 1, 4, 7, 9 },
+		{ -2, -4, -8, -10, 1, 3, 7, 9 },
+		{ -2, -5, -7, -10, 1, 4, 6, 9 },
+		{ -3, -4, -7, -10, 2, 3, 6, 9 },
+		{ -1, -2, -3, -10, 0, 1, 2, 9 },
+		{ -4, -6, -8, -9, 3, 5, 7, 8 },
+		{ -3, -5, -7, -9, 2, 4, 6, 8 }
+	};
+
+	/* Sign extended 3 bit delta, pre-shifted by 3 */
+	const int ETCDeltaTable[8] = { 0, 8, 16, 24, -32, -24, -16, -8 };
+
+	/* Detex writes RGBA8, swap red and blue in place */
+	void SwizzleRGBAToBGRA(uint8* Pixels) {
+		for (int i = 0; i < 16; i++) {
+			uint8* Pixel = Pixels + i * 4;
+			const uint8 Red = Pixel[0];
+			Pixel[0] = Pixel[2];
+			Pixel[2] = Red;
+		}
+	}
+
+	bool DecodeBlockETC2RGBDetex(const uint8* Block, uint8* OutPixels) {
+		if (!detexDecompressBlockETC2(Block, DETEX_MODE_MASK_ALL, 0, OutPixels)) {
+			return false;
+		}
+
+		SwizzleRGBAToBGRA(OutPixels);
+		return true;
+	}
+
+	/* ETC pixel indices are stored column-major, lsb and msb planes 16 bits apart */
+	FORCEINLINE void ExpandIndexedPixels(const uint8* Block, const uint32* Palette, const bool bFlip, uint8* OutPixels) {
+		const uint32 IndexWord = (static_cast<uint32>(Block[4]) << 24) | (static_cast<uint32>(Block[5]) << 16) |
+			(static_cast<uint32>(Block[6]) << 8) | Block[7];
+
+		uint32* Out = reinterpret_cast<uint32*>(OutPixels);
+
+		for (int i = 0; i < 16; i++) {
+			const int X = i >> 2;
+			const int Y = i & 3;
+			const uint32 Index = ((IndexWord >> i) & 1) | (((IndexWord >> (16 + i)) & 1) << 1);
+			const uint32 Subblock = bFlip ? (Y >= 2) : (X >= 2);
+
+			Out[Y * 4 + X] = Palette[Subblock * 4 + Index];
+		}
+	}
+
+#if JSONASASSET_ETC_SSE2
+	/* Four BGRA8 colors of a subblock, base + modifier with saturation */
+	FORCEINLINE __m128i BuildSubblockPalette(const int R, const int G, const int B, const uint32 Codeword) {
+		const int16* Modifiers = ETCModifierTable[Codeword];
+		const __m128i Base = _mm_setr_epi16(B, G, R, 255, B, G, R, 255);
+
+		const __m128i Low = _mm_add_epi16(Base, _mm_setr_epi16(
+			Modifiers[0], Modifiers[0], Modifiers[0], 0, Modifiers[1], Modifiers[1], Modifiers[1], 0));
+		const __m128i High = _mm_add_epi16(Base, _mm_setr_epi16(
+			Modifiers[2], Modifiers[2], Modifiers[2], 0, Modifiers[3], Modifiers[3], Modifiers[3], 0));
+
+		return _mm_packus_epi16(Low, High);
+	}
+
+	void DecodeIndividualOrDifferential(const uint8* Block, const int R1, const int G1, const int B1, const int R2, const int G2, const int B2, uint8* OutPixels) {
+		const uint32 Codeword1 = (Block[3] & 224) >> 5;
+		const uint32 Codeword2 = (Block[3] & 28) >> 2;
+
+		alignas(16) uint32 Palette[8];
+		_mm_store_si128(reinterpret_cast<__m128i*>(Palette), BuildSubblockPalette(R1, G1, B1, Codeword1));
+		_mm_store_si128(reinterpret_cast<__m128i*>(Palette + 4), BuildSubblockPalette(R2, G2, B2, Codeword2));
+
+		ExpandIndexedPixels(Block, Palette, (Block[3] & 1) != 0, OutPixels);
+	}
+
+	void DecodePlanar(const uint8* Block, uint8* OutPixels) {
+		/* Each color O, H and V is in 6-7-6 format */
+		int RO = (Block[0] & 0x7E) >> 1;
+		int GO = ((Block[0] & 0x1) << 6) | ((Block[1] & 0x7E) >> 1);
+		int BO = ((Block[1] & 0x1) << 5) | (Block[2] & 0x18) | ((Block[2] & 0x03) << 1) | ((Block[3] & 0x80) >> 7);
+		int RH = ((Block[3] & 0x7B) >> 1) | (Block[3] & 0x1);
+		int GH = (Block[4] & 0xFE) >> 1;
+		int BH = ((Block[4] & 0x1) << 5) | ((Block[5] & 0xF8) >> 3);
+		int RV = ((Block[5] & 0x7) << 3) | ((Block[6] & 0xE0) >> 5);
+		int GV = ((Block[6] & 0x1F) << 2) | ((Block[7] & 0xC0) >> 6);
+		int BV = Block[7] & 0x3F;
+
+		RO = (RO << 2) | ((RO & 0x30) >> 4);
+		GO = (GO << 1) | ((GO & 0x40) >> 6);
+		BO = (BO << 2) | ((BO & 0x30) >> 4);
+		RH = (RH << 2) | ((RH & 0x30) >> 4);
+		GH = (GH << 1) | ((GH & 0x40) >> 6);
+		BH = (BH << 2) | ((BH & 0x30) >> 4);
+		RV = (RV << 2) | ((RV & 0x30) >> 4);
+		GV = (GV << 1) | ((GV & 0x40) >> 6);
+		BV = (BV << 2) | ((BV & 0x30) >> 4);
+
+		/* (x * (H - O) + y * (V - O) + 4 * O + 2) >> 2, two pixels per register */
+		const int DBH = BH - BO, DGH = GH - GO, DRH = RH - RO;
+		const __m128i Origin = _mm_setr_epi16(4 * BO + 2, 4 * GO + 2, 4 * RO + 2, 0, 4 * BO + 2, 4 * GO + 2, 4 * RO + 2, 0);
+		const __m128i Vertical = _mm_setr_epi16(BV - BO, GV - GO, RV - RO, 0, BV - BO, GV - GO, RV - RO, 0);
+		const __m128i Columns01 = _mm_setr_epi16(0, 0, 0, 0, DBH, DGH, DRH, 0);
+		const __m128i Columns23 = _mm_setr_epi16(2 * DBH, 2 * DGH, 2 * DRH, 0, 3 * DBH, 3 * DGH, 3 * DRH, 0);
+		const __m128i Alpha = _mm_set1_epi32(static_cast<int>(0xFF000000));
+
+		__m128i Row = Origin;
+		for (int Y = 0; Y < 4; Y++) {
+			const __m128i Low = _mm_srai_epi16(_mm_add_epi16(Row, Columns01), 2);
+			const __m128i High = _mm_srai_epi16(_mm_add_epi16(Row, Columns23), 2);
+
+			_mm_storeu_si128(reinterpret_cast<__m128i*>(OutPixels + Y * 16), _mm_or_si128(_mm_packus_epi16(Low, High), Alpha));
+			Row = _mm_add_epi16(Row, Vertical);
+		}
+	}
+#endif
+}
+
+bool DecodeBlockETC2RGB(const uint8* Block, uint8* OutPixels) {
+#if JSONASASSET_ETC_SSE2
+	/* Individual mode, two 4-4-4 base colors */
+	if ((Block[3] & 2) == 0) {
+		const int R1 = (Block[0] & 0xF0) | (Block[0] >> 4);
+		const int G1 = (Block[1] & 0xF0) | (Block[1] >> 4);
+		const int B1 = (Block[2] & 0xF0) | (Block[2] >> 4);
+		const int R2 = (Block[0] & 0x0F) | ((Block[0] & 0x0F) << 4);
+		const int G2 = (Block[1] & 0x0F) | ((Block[1] & 0x0F) << 4);
+		const int B2 = (Block[2] & 0x0F) | ((Block[2] & 0x0F) << 4);
+
+		DecodeIndividualOrDifferential(Block, R1, G1, B1, R2, G2, B2, OutPixels);
+		return true;
+	}
+
+	/* An overflowing differential color selects the ETC2 T, H or planar mode */
+	const int R = (Block[0] & 0xF8) + ETCDeltaTable[Block[0] & 7];
+	const int G = (Block[1] & 0xF8) + ETCDeltaTable[Block[1] & 7];
+	const int B = (Block[2] & 0xF8) + ETCDeltaTable[Block[2] & 7];
+
+	if ((R & 0xFF07) || (G & 0xFF07)) {
+		return DecodeBlockETC2RGBDetex(Block, OutPixels);
+	}
+
+	if (B & 0xFF07) {
+		DecodePlanar(Block, OutPixels);
+		return true;
+	}
+
+	/* Differential mode, 5-5-5 base color plus a 3 bit delta */
+	const int R1 = (Block[0] & 0xF8) | ((Block[0] & 0xF8) >> 5);
+	const int G1 = (Block[1] & 0xF8) | ((Block[1] & 0xF8) >> 5);
+	const int B1 = (Block[2] & 0xF8) | ((Block[2] & 0xF8) >> 5);
+
+	DecodeIndividualOrDifferential(Block, R1, G1, B1, R | (R >> 5), G | (G >> 5), B | (B >> 5), OutPixels);
+	return true;
+#else
+	return DecodeBlockETC2RGBDetex(Block, OutPixels);
+#endif
+}
+
+bool DecodeBlockETC2RGBA(const uint8* Block, uint8* OutPixels) {
+	/* Color lives in the second half of the block */
+	if (!DecodeBlockETC2RGB(Block + 8, OutPixels)) {
+		return false;
+	}
+
+	const int BaseCodeword = Block[0];
+	const int8* Modifiers = EACModifierTable[Block[1] & 0x0F];
+	const int Multiplier = (Block[1] & 0xF0) >> 4;
+
+	const uint64 AlphaIndices = (static_cast<uint64>(Block[2]) << 40) | (static_cast<uint64>(Block[3]) << 32) |
+		(static_cast<uint64>(Block[4]) << 24) | (static_cast<uint64>(Block[5]) << 16) |
+		(static_cast<uint64>(Block[6]) << 8) | Block[7];
+
+	for (int i = 0; i < 16; i++) {
+		const int Modifier = Modifiers[(AlphaIndices >> (45 - i * 3)) & 7];
+		const int Alpha = FMath::Clamp(BaseCodeword + Modifier * Multiplier, 0, 255);
+
+		/* Column-major, like the color indices */
+		OutPixels[((i & 3) * 4 + (i >> 2)) * 4 + 3] = static_cast<uint8>(Alpha);
+	}
+
+	return true;
+}
+
+bool DecodeBlockEACR11(const uint8* Block, uint8* OutPixels) {
+	uint16 Values[16];
+
+	if (!detexDecompressBlockEAC_R11(Block, DETEX_MODE_MASK_ALL, 0, reinterpret_cast<uint8*>(Values))) {
+		return false;
+	}
+
+	for (int i = 0; i < 16; i++) {
+		const uint8 Value = Values[i] >> 8;
+
+		OutPixels[i * 4 + 0] = Value;
+		OutPixels[i * 4 + 1] = Value;
+		OutPixels[i * 4 + 2] = Value;
+		OutPixels[i * 4 + 3] = 255;
+	}
+
+	return true;
+}
+
+bool DecodeBlockEACRG11(const uint8* Block, uint8* OutPixels) {
+	uint16 Values[32];
+
+	if (!detexDecompressBlockEAC_RG11(Block, DETEX_MODE_MASK_ALL, 0, reinterpret_cast<uint8*>(Values))) {
+		return false;
+	}
+
+	for (int i = 0; i < 16; i++) {
+		const uint8 X = Values[i * 2] >> 8;
+		const uint8 Y = Values[i * 2 + 1] >> 8;
+
+		const float NX = 2 * (X / 255.0f) - 1;
+		const float NY = 2 * (Y / 255.0f) - 1;
+		const float NZ = 1 - NX * NX - NY * NY > 0 ? FMath::Sqrt(1 - NX * NX - NY * NY) : 0.0f;
+
+		OutPixels[i * 4 + 0] = static_cast<uint8>(FMath::Clamp(static_cast<int>(255.0f * (NZ + 1) / 2.0f), 0, 255));
+		OutPixels[i * 4 + 1] = Y;
+		OutPixels[i * 4 + 2] = X;
+		OutPixels[i * 4 + 3] = 255;
+	}
+
+	return true;
+}
@@ -0,0 +1,21 @@
+// Copyright JAA Contributors 2024-2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/*
+ * ETC2/EAC block decoders, each one writes 16 row-major BGRA8 pixels and
+ * matches the FDecodeBlockFunction signature of the tile-parallel driver.
+ *
+ * Individual, differential and planar color blocks are decoded with SSE2,
+ * T and H blocks go through Detex.
+ */
+bool DecodeBlockETC2RGB(const uint8* Block, uint8* OutPixels);
+bool DecodeBlockETC2RGBA(const uint8* Block, uint8* OutPixels);
+
+/* Single channel, replicated to gray like PF_G8 */
+bool DecodeBlockEACR11(const uint8* Block, uint8* OutPixels);
+
+/* Two channel normal map, Z is rebuilt the same way NVTT does for BC5 */
+bool DecodeBlockEACRG11(const uint8* Block, uint8* OutPixels);
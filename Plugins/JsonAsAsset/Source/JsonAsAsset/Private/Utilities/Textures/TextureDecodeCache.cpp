@@ -0,0 +1,98 @@
+// Copyright JAA Contributors 2024-2025
+
+#include "Utilities/Textures/TextureDecodeCache.h"
+
+#include "Hash/CityHash.h"
+#include "Misc/ScopeLock.h"
+
+FCriticalSection FTextureDecodeCache::CriticalSection;
+TMap<FTextureDecodeKey, FTextureDecodeCache::FEntry> FTextureDecodeCache::Entries;
+FTextureDecodeCache::FInsertionOrder FTextureDecodeCache::InsertionOrder;
+int64 FTextureDecodeCache::CachedBytes = 0;
+
+FThreadSafeCounter64 FTextureDecodeCache::Hits;
+FThreadSafeCounter64 FTextureDecodeCache::Misses;
+
+FTextureDecodeKey FTextureDecodeCache::MakeKey(const uint8* Data, const int32 DataSize, const int32 SizeX, const int32 SizeY, const int32 SizeZ, const EPixelFormat Format) {
+	FTextureDecodeKey Key;
+	Key.PayloadHash = Data != nullptr && DataSize > 0 ? CityHash64(reinterpret_cast<const char*>(Data), DataSize) : 0;
+	Key.PayloadSize = DataSize;
+	Key.SizeX = SizeX;
+	Key.SizeY = SizeY;
+	Key.SizeZ = SizeZ;
+	Key.Format = Format;
+
+	return Key;
+}
+
+bool FTextureDecodeCache::Find(const FTextureDecodeKey& Key, uint8* OutData, const int32 TotalSize) {
+	FScopeLock Lock(&CriticalSection);
+
+	const FEntry* Entry = Entries.Find(Key);
+
+	/* A differently sized destination means a different decode, treat it as a miss */
+	if (Entry == nullptr || Entry->Data.Num() != TotalSize) {
+		Misses.Increment();
+		return false;
+	}
+
+	FMemory::Memcpy(OutData, Entry->Data.GetData(), TotalSize);
+	Hits.Increment();
+
+	return true;
+}
+
+void FTextureDecodeCache::Add(const FTextureDecodeKey& Key, const uint8* DecodedData, const int32 TotalSize) {
+	/* Never keep something that could not fit on its own */
+	if (DecodedData == nullptr || TotalSize <= 0 || TotalSize > MaxCachedBytes) {
+		return;
+	}
+
+	FScopeLock Lock(&CriticalSection);
+
+	if (const FEntry* Existing = Entries.Find(Key)) {
+		CachedBytes -= Existing->Data.Num();
+		InsertionOrder.RemoveNode(Existing->Node);
+		Entries.Remove(Key);
+	}
+
+	/* Evict oldest entries until the new one fits */
+	while (CachedBytes + TotalSize > MaxCachedBytes && InsertionOrder.GetHead() != nullptr) {
+		FInsertionOrder::TDoubleLinkedListNode* Oldest = InsertionOrder.GetHead();
+
+		if (const FEntry* Evicted = Entries.Find(Oldest->GetValue())) {
+			CachedBytes -= Evicted->Data.Num();
+			Entries.Remove(Oldest->GetValue());
+		}
+
+		InsertionOrder.RemoveNode(Oldest);
+	}
+
+	InsertionOrder.AddTail(Key);
+
+	FEntry& Entry = Entries.Add(Key);
+	Entry.Data.SetNumUninitialized(TotalSize);
+	FMemory::Memcpy(Entry.Data.GetData(), DecodedData, TotalSize);
+	Entry.Node = InsertionOrder.GetTail();
+
+	CachedBytes += TotalSize;
+}
+
+void FTextureDecodeCache::Empty() {
+	FScopeLock Lock(&CriticalSection);
+
+	Entries.Empty();
+	InsertionOrder.Empty();
+	CachedBytes = 0;
+}
+
+int64 FTextureDecodeCache::GetCachedBytes() {
+	FScopeLock Lock(&CriticalSection);
+
+	return CachedBytes;
+}
+
+void FTextureDecodeCache::ResetCounters() {
+	Hits.Reset();
+	Misses.Reset();
+}
@@ -0,0 +1,33 @@
+// Copyright JAA Contributors 2024-2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonValue.h"
+
+// Material Function Import Planner
+// Imports every material function a set of files depends on before any material,
+// leaves first, so graphs never stop to import a nested function.
+class FMaterialFunctionImportPlanner {
+public:
+	/*
+	 * Imports the functions in dependency order. Selected files that were planned are removed from Files,
+	 * selected materials that were parsed for their references are handed back in OutParsedFiles
+	 */
+	static void ImportFunctionsFirst(TArray<FString>& Files, TMap<FString, TArray<TSharedPtr<FJsonValue>>>& OutParsedFiles);
+
+private:
+	struct FPlannedFunction {
+		FString File;
+		TArray<TSharedPtr<FJsonValue>> Exports;
+		TArray<FString> Dependencies;
+	};
+
+	/* Parses files whose first export is a material or material function, other files are only classified */
+	static bool ReadExports(const FString& File, FString& OutType, TArray<TSharedPtr<FJsonValue>>& OutExports);
+
+	/* Game paths of every function called by the expressions of an asset */
+	static TArray<FString> CollectFunctionReferences(const TArray<TSharedPtr<FJsonValue>>& Exports);
+
+	static void VisitFunction(const FString& GamePath, TMap<FString, FPlannedFunction>& Functions, TSet<FString>& Visiting, TSet<FString>& Visited, TArray<FString>& OutOrder);
+};
@@ -20,9 +20,15 @@ public:
 
 	// Creates a empty USoundNode
 	static USoundNode* CreateEmptyNode(FName Name, FName Type, USoundCue* SoundCue);
+	static USoundNode* CreateEmptyNode(UClass* Class, USoundCue* SoundCue);
 
-	static void ConstructNodes(USoundCue* SoundCue, TArray<TSharedPtr<FJsonValue>> JsonArray, TMap<FString, USoundNode*>& OutNodes);
-	void SetupNodes(USoundCue* SoundCueAsset, TMap<FString, USoundNode*> SoundCueNodes, TArray<TSharedPtr<FJsonValue>> JsonObjectArray);
+	// Name of a node from the object name of a reference to it
+	static FString GetNodeName(const FString& ObjectName);
+
+	static void ConstructNodes(USoundCue* SoundCue, const TArray<TSharedPtr<FJsonValue>>& JsonArray, TMap<FString, USoundNode*>& OutNodes);
+
+	/* Sets the first node and the child nodes, the graph is linked from them by LinkGraphNodesFromSoundNodes */
+	void SetupNodes(USoundCue* SoundCueAsset, const TMap<FString, USoundNode*>& SoundCueNodes, const TArray<TSharedPtr<FJsonValue>>& JsonObjectArray);
 
 	// Sound Wave Import
 	void ImportSoundWave(const FString& URL, FString SavePath, FString AssetPtr, USoundNodeWavePlayer* Node) const;
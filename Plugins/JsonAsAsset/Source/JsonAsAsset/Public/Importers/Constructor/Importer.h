@@ -12,6 +12,8 @@
 
 extern TArray<FString> ImporterAcceptedTypes;
 
+struct FDataTableRowStream;
+
 /* Global handler for converting JSON to assets */
 class IImporter {
 public:
@@ -75,11 +77,15 @@ public:
     template<class T = UObject>
     TArray<TObjectPtr<T>> LoadObject(const TArray<TSharedPtr<FJsonValue>>& PackageArray, TArray<TObjectPtr<T>> Array);
 
+    /* Package path of an exported object path, with the game and engine content folders mapped to their mount points */
+    static FString GetPackagePath(const FString& ObjectPath);
+
     /* LoadObject functions ---------------------------------------------------------------------- */
 public:
     void ImportReference(const FString& File) const;
     bool ImportAssetReference(const FString& GamePath) const;
-    bool ImportExports(TArray<TSharedPtr<FJsonValue>> Exports, FString File, bool bHideNotifications = false) const;
+    static FString GetAssetReferenceFile(const FString& GamePath, const FString& ReferencingFile);
+    bool ImportExports(TArray<TSharedPtr<FJsonValue>> Exports, FString File, bool bHideNotifications = false, const TSharedPtr<FDataTableRowStream>& RowStream = nullptr) const;
 
 public:
     TArray<TSharedPtr<FJsonValue>> GetObjectsWithTypeStartingWith(const FString& StartsWithStr);
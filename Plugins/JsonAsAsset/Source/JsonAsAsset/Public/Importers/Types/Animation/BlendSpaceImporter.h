@@ -8,7 +8,7 @@
 /* Access the samples variable */
 class CBlendSpaceDerived : public UBlendSpace {
 public:
-	void CreateNewSample(UAnimSequence* AnimationSequence, const FVector& SampleValue);
+	void SetSamples(TArray<FBlendSample>&& Samples);
 };
 
 class IBlendSpaceImporter : public IImporter {
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "Importers/Constructor/Importer.h"
+#include "MaterialShared.h"
 
 class IMaterialInstanceConstantImporter : public IImporter {
 public:
@@ -11,4 +12,12 @@ public:
 	}
 
 	virtual bool Import() override;
+
+protected:
+	static FMaterialParameterInfo ReadParameterInfo(const TSharedPtr<FJsonObject>& Parameter);
+
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 2
+	/* True when every overridden static parameter has the value the parent already compiles with */
+	static bool StaticParametersMatchParent(const FStaticParameterSet& StaticParameters, const FStaticParameterSet& ParentStaticParameters);
+#endif
 };
@@ -18,4 +18,8 @@ public:
 
 	static USkeletalBodySetup* CreateNewBody(UPhysicsAsset* PhysAsset, FName ExportName, FName BoneName);
 	static UPhysicsConstraintTemplate* CreateNewConstraint(UPhysicsAsset* PhysAsset, FName ExportName);
+
+protected:
+	/* Export of a body or constraint reference, by its export index. Exports is only filled if an index doesn't match */
+	FJsonObject* FindSubobjectExport(const TSharedPtr<FJsonObject>& Reference, FName ExportName, TMap<FName, FExportData>& Exports);
 };
@@ -7,7 +7,8 @@
 // We use this to set variables in the skeletal asset
 class CSkeletonAssetDerived : public USkeleton {
 public:
-	bool AddVirtualBone(const FName SourceBoneName, const FName TargetBoneName, const FName VirtualBoneRootName);
+	/* Appends virtual bones that aren't on the skeleton yet, the virtual bone guid is changed once */
+	void AddVirtualBones(const TArray<FVirtualBone>& NewVirtualBones);
 };
 
 class ISkeletonImporter : public IImporter {
@@ -4,14 +4,45 @@
 
 #include "Importers/Constructor/Importer.h"
 #include "UObject/StructOnScope.h"
+#include "Engine/DataTable.h"
+#include "Serialization/JsonReader.h"
+
+// The row map is protected, rows decoded by the importer are handed to
+// the table through this subclass without copying them again.
+class CDataTableDerived : public UDataTable {
+public:
+	/* Takes ownership of the row memory, entries taken are set to null */
+	void AddRows(const TArray<FName>& Names, TArray<uint8*>& Rows);
+};
+
+/* Rows object of a data table read from its file, handed by ImportStreamed to the importer of that table */
+struct FDataTableRowStream {
+	TSharedPtr<TJsonReader<TCHAR>> Reader;
+
+	/* Set once every row was read, the reader is then past the rows */
+	bool bRowsRead = false;
+};
 
 class IDataTableImporter : public IImporter {
 public:
 	using FTableRowMap = TMap<FName, TSharedPtr<class FStructOnScope>>;
 
-	IDataTableImporter(const FString& FileName, const FString& FilePath, const TSharedPtr<FJsonObject>& JsonObject, UPackage* Package, UPackage* OutermostPkg):
-		IImporter(FileName, FilePath, JsonObject, Package, OutermostPkg) {
+	IDataTableImporter(const FString& FileName, const FString& FilePath, const TSharedPtr<FJsonObject>& JsonObject, UPackage* Package, UPackage* OutermostPkg, const TSharedPtr<FDataTableRowStream>& InRowStream = nullptr):
+		IImporter(FileName, FilePath, JsonObject, Package, OutermostPkg), RowStream(InRowStream) {
 	}
 
 	virtual bool Import() override;
+
+	/*
+	 * Imports a data table without loading the whole file first, it is read from
+	 * disk as rows are decoded and their Json is released right after. False when
+	 * the file doesn't start with a data table, it is then imported as usual.
+	 */
+	static bool ImportStreamed(const FString& File);
+
+private:
+	/* Rows of this table when it is streamed, null when they are in the Json object */
+	TSharedPtr<FDataTableRowStream> RowStream;
+
+	bool ReadRowStream(UDataTable* DataTable, UScriptStruct* TableRowStruct) const;
 };
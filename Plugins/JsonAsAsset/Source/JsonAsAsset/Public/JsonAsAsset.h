@@ -34,6 +34,9 @@ private:
     void CreateLocalFetchDropdown(FMenuBuilder MenuBuilder) const;
     void ImportConvexCollision() const;
 
+    /* Pulls texture exports out of the selected files and imports them as one batch through Local Fetch */
+    void ImportTextureFiles(TArray<FString>& Files) const;
+
     bool bActionRequired = false;
     UJsonAsAssetSettings* Settings = nullptr;
 
@@ -41,7 +41,7 @@ struct FJTextureImportSettings
 public:
 	/* Constructor to initialize default values */
 	FJTextureImportSettings()
-		: bDownloadExistingTextures(false)
+		: bDownloadExistingTextures(false), bCacheDecodedTextures(true)
 	{}
 
 	/**
@@ -52,6 +52,71 @@ public:
 	 */
 	UPROPERTY(EditAnywhere, Config, Category = "Local Fetch - Encryption", meta=(EditCondition="bEnableLocalFetch"), AdvancedDisplay)
 	bool bDownloadExistingTextures;
+
+	/**
+	 * Keeps decoded texture data in memory, keyed by a hash of the compressed payload and its format.
+	 *
+	 * Re-importing materials or importing games that share base content will reuse the decoded result
+	 * instead of decompressing the same payload again.
+	 */
+	UPROPERTY(EditAnywhere, Config, Category = "Texture Import Settings", AdvancedDisplay)
+	bool bCacheDecodedTextures;
+};
+
+/* Settings for curves */
+USTRUCT()
+struct FJCurveImportSettings
+{
+	GENERATED_BODY()
+public:
+	/* Constructor to initialize default values */
+	FJCurveImportSettings()
+		: bReduceCurveKeys(false), KeyReductionTolerance(0.0001f)
+	{}
+
+	/**
+	 * Removes curve keys that their neighbouring keys already reproduce, for float curves, vector curves and animation curves.
+	 *
+	 * Use Case:
+	 * Exported curves are often baked with a key on every frame, this keeps only the keys needed to reproduce the curve.
+	 * The key count before and after, and the largest error, are written to the output log.
+	 */
+	UPROPERTY(EditAnywhere, Config, Category = "Curve Import Settings")
+	bool bReduceCurveKeys;
+
+	/**
+	 * Largest difference allowed between the reduced curve and the original one, at the original keys and between them.
+	 */
+	UPROPERTY(EditAnywhere, Config, Category = "Curve Import Settings", meta=(EditCondition="bReduceCurveKeys", ClampMin="0.0"))
+	float KeyReductionTolerance;
+};
+
+/* Settings for data tables */
+USTRUCT()
+struct FJDataTableImportSettings
+{
+	GENERATED_BODY()
+public:
+	/* Constructor to initialize default values */
+	FJDataTableImportSettings()
+		: bStreamLargeTables(true), StreamingThresholdMB(64)
+	{}
+
+	/**
+	 * Reads the rows of large data tables one after the other, each row is imported as soon as it is read.
+	 *
+	 * Use Case:
+	 * Tables with tens of thousands of rows no longer need the whole file parsed before the first row is imported,
+	 * memory stays close to the size of the file instead of the size of its parsed tree.
+	 */
+	UPROPERTY(EditAnywhere, Config, Category = "Data Table Import Settings")
+	bool bStreamLargeTables;
+
+	/**
+	 * Files of this size or larger are streamed, smaller ones are parsed at once.
+	 */
+	UPROPERTY(EditAnywhere, Config, Category = "Data Table Import Settings", meta=(EditCondition="bStreamLargeTables", ClampMin="0", Units="Megabytes"))
+	int32 StreamingThresholdMB;
 };
 
 /* Settings for sounds */
@@ -76,6 +141,8 @@ public:
 		MaterialImportSettings = FJMaterialImportSettings();
 		SoundImportSettings = FJSoundImportSettings();
 		TextureImportSettings = FJTextureImportSettings();
+		CurveImportSettings = FJCurveImportSettings();
+		DataTableImportSettings = FJDataTableImportSettings();
 	}
 
 	UPROPERTY(EditAnywhere, Config, Category = "Asset Settings")
@@ -87,6 +154,12 @@ public:
 	UPROPERTY(EditAnywhere, Config, Category = "Asset Settings")
 	FJSoundImportSettings SoundImportSettings;
 
+	UPROPERTY(EditAnywhere, Config, Category = "Asset Settings")
+	FJCurveImportSettings CurveImportSettings;
+
+	UPROPERTY(EditAnywhere, Config, Category = "Asset Settings")
+	FJDataTableImportSettings DataTableImportSettings;
+
 	UPROPERTY(EditAnywhere, Config, Category = "Asset Settings", meta = (DisplayName = "Save Assets On Import"))
 	bool bSavePackagesOnImport;
 
@@ -0,0 +1,39 @@
+// Copyright JAA Contributors 2024-2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UAnimSequence;
+class UPackage;
+
+/*
+ * Scope that holds back animation compression while an import batch runs.
+ *
+ * Sequences imported inside the scope are marked dirty, and compressed together
+ * when the outermost scope ends. On Unreal Engine 5.2 and above every sequence is
+ * started on the async derived data path first, and the batch then waits for all
+ * of them behind a progress bar, so compression runs on every core. Older engines
+ * queue every sequence on their async compression manager instead, and wait for
+ * each of them. Their packages are saved after they are compressed, not before.
+ */
+class FAnimationCompressionBatch {
+public:
+	FAnimationCompressionBatch();
+	~FAnimationCompressionBatch();
+
+	static bool IsActive();
+
+	/* Holds back compression of a sequence, returns false when it has to run now */
+	static bool Defer(UAnimSequence* AnimSequence);
+
+	/* Holds back the save of a package with a sequence in it, until the batch compressed it */
+	static bool DeferSave(UPackage* Package);
+
+private:
+	static void Flush();
+
+	static int32 Depth;
+	static TArray<TWeakObjectPtr<UAnimSequence>> PendingSequences;
+	static TArray<TWeakObjectPtr<UPackage>> PendingPackages;
+};
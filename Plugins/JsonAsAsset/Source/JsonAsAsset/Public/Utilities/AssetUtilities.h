@@ -14,6 +14,9 @@ public:
 	static UPackage* CreateAssetPackage(const FString& FullPath);
 	static UPackage* CreateAssetPackage(const FString& Name, const FString& OutputPath);
 	static UPackage* CreateAssetPackage(const FString& Name, const FString& OutputPath, UPackage*& OutOutermostPkg);
+
+	/* Package name CreateAssetPackage places an asset in, nothing is created */
+	static FString GetAssetPackageName(const FString& Name, const FString& OutputPath);
 	
 public:
 	template <class T = UObject>
@@ -21,9 +24,24 @@ public:
 	
 	static bool Construct_TypeTexture(const FString& Path, const FString& RealPath, UTexture*& OutTexture);
 
+	/*
+	* Batch version of Construct_TypeTexture, fetches every texture, decodes them
+	* on the task graph, creates the UTextures and saves all packages in one sweep.
+	*
+	* @return True if every texture was created
+	*/
+	static bool Construct_TypeTextures(const TArray<FString>& Paths, TArray<UTexture*>& OutTextures);
+
+	/* Saves packages in one sweep, if the user opted to save packages on import */
+	static void SavePackages(const TArray<UPackage*>& Packages);
+
 	// Creates a plugin in the name (may result in bugs if inputted wrong)
 	static void CreatePlugin(FString PluginName);
 
 	static TSharedPtr<FJsonObject> API_RequestExports(const FString& Path,
 	                                                  const FString& FetchPath = "/api/v1/export?raw=true&path=");
+
+private:
+	static bool FetchTextureExport(const FString& RealPath, TSharedPtr<FJsonObject>& OutJsonExport, TArray<uint8>& OutData);
+	static UTexture* CreateTextureFromExport(const FString& Path, const TSharedPtr<FJsonObject>& JsonExport, TArray<uint8>& Data, const TArray<uint8>* DecodedData = nullptr);
 };
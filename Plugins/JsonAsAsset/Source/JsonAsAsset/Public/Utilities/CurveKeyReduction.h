@@ -0,0 +1,56 @@
+// Copyright JAA Contributors 2024-2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Curves/RichCurve.h"
+
+/* Key counts and error of a key reduction, used for the import report */
+struct JSONASASSET_API FCurveKeyReductionResult {
+	int32 KeysBefore = 0;
+	int32 KeysAfter = 0;
+	float MaxError = 0.0f;
+
+	void Append(const FCurveKeyReductionResult& Other);
+};
+
+/*
+ * Import-time key reduction for rich curves.
+ *
+ * A key is removed when the segment between the keys kept around it reproduces the
+ * original curve within the tolerance. Both are cubics in time between two original
+ * keys, so the largest difference is found exactly.
+ *
+ * Kept keys in auto tangent mode are measured and written with the tangents the
+ * engine computes from their new neighbours, so removing a key also checks the
+ * segments next to it. Other automatic tangent modes keep their keys.
+ */
+class JSONASASSET_API FCurveKeyReduction {
+public:
+	/* True when reduction is enabled in the settings */
+	static bool IsEnabled(float& OutTolerance);
+
+	/* Keys have to be sorted by time, other curves are left untouched */
+	static FCurveKeyReductionResult ReduceKeys(TArray<FRichCurveKey>& Keys, float Tolerance);
+
+	/* Writes the key counts and max error of an asset to the output log */
+	static void Report(const FString& AssetName, const FCurveKeyReductionResult& Result);
+
+private:
+	static float EvaluateSegment(const FRichCurveKey& From, const FRichCurveKey& To, float Time);
+
+	/* Largest difference between the segment From-To and the original segment SubFrom-SubTo, over the time of the latter */
+	static float GetSegmentDifference(const FRichCurveKey& From, const FRichCurveKey& To, const FRichCurveKey& SubFrom, const FRichCurveKey& SubTo);
+
+	/* True for keys whose tangents are exported as they are, or follow the auto tangent rule */
+	static bool HasKnownTangents(const FRichCurveKey& Key);
+
+	/* Key at Index with the tangents it gets between the kept keys Prev and Next, INDEX_NONE at either end */
+	static FRichCurveKey GetKeptKey(const TArray<FRichCurveKey>& Keys, int32 Prev, int32 Index, int32 Next);
+
+	/* Largest error of replacing the keys between From and To with one segment, between the kept keys Prev and Next */
+	static bool GetSegmentError(const TArray<FRichCurveKey>& Keys, int32 Prev, int32 From, int32 To, int32 Next, float& OutError);
+
+	/* True when the segment from the last kept key can reach To, with every segment it changes within the tolerance */
+	static bool CanExtendSegment(const TArray<FRichCurveKey>& Keys, const TArray<int32>& Kept, int32 To, float Tolerance);
+};
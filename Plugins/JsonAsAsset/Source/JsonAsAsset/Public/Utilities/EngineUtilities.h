@@ -104,11 +104,9 @@ inline void SpawnPrompt(const FString& Title, const FString& Text) {
 	FMessageDialog::Open(EAppMsgType::Ok, DialogMessage);
 }
 
-// Gets all assets in selected folder
-inline TArray<FAssetData> GetAssetsInSelectedFolder()
+// Gets the folder selected in the Content Browser
+inline bool GetSelectedContentFolder(FString& OutFolder)
 {
-	TArray<FAssetData> AssetDataList;
-
 	// Get the Content Browser Module
 	FContentBrowserModule& ContentBrowserModule = FModuleManager::LoadModuleChecked<FContentBrowserModule>("ContentBrowser");
 
@@ -118,18 +116,32 @@ inline TArray<FAssetData> GetAssetsInSelectedFolder()
 	if (SelectedFolders.Num() == 0)
 	{
 		UE_LOG(LogTemp, Warning, TEXT("No folder selected in the Content Browser."));
-		return AssetDataList; 
+		return false;
 	}
 
-	FString CurrentFolder = SelectedFolders[0];
+	OutFolder = SelectedFolders[0];
 
 	// Check if the folder is the root folder, and show a prompt if so
-	if (CurrentFolder == "/Game")
+	if (OutFolder == "/Game")
 	{
 		SpawnPrompt(
 			"Action Not Allowed in Root Content Folder",
 			"You can't do this action in the root folder, this will stall the editor for a long time."
 		);
+		return false;
+	}
+
+	return true;
+}
+
+// Gets all assets in selected folder
+inline TArray<FAssetData> GetAssetsInSelectedFolder()
+{
+	TArray<FAssetData> AssetDataList;
+
+	FString CurrentFolder;
+	if (!GetSelectedContentFolder(CurrentFolder))
+	{
 		return AssetDataList;
 	}
 
@@ -143,6 +155,48 @@ inline TArray<FAssetData> GetAssetsInSelectedFolder()
 	return AssetDataList;
 }
 
+// Finds an asset of a class by name in the selected folder
+// Only the asset registry is searched, the matching asset is the only one loaded
+// Only the selected folder is scanned, the registry skips it on later lookups once it was scanned
+template <typename T>
+T* FindAssetInSelectedFolder(const FString& AssetName)
+{
+	FString CurrentFolder;
+	if (!GetSelectedContentFolder(CurrentFolder))
+	{
+		return nullptr;
+	}
+
+	FARFilter Filter;
+	Filter.PackagePaths.Add(FName(*CurrentFolder));
+	Filter.bRecursivePaths = true;
+	Filter.bRecursiveClasses = true;
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1
+	Filter.ClassPaths.Add(T::StaticClass()->GetClassPathName());
+#else
+	Filter.ClassNames.Add(T::StaticClass()->GetFName());
+#endif
+
+	// Get the Asset Registry Module
+	FAssetRegistryModule& AssetRegistryModule = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry");
+	AssetRegistryModule.Get().ScanPathsSynchronous({ CurrentFolder }, false);
+
+	TArray<FAssetData> AssetDataList;
+	AssetRegistryModule.Get().GetAssets(Filter, AssetDataList);
+
+	const FName Name = FName(*AssetName);
+
+	for (const FAssetData& AssetData : AssetDataList)
+	{
+		if (AssetData.AssetName == Name)
+		{
+			return Cast<T>(AssetData.GetAsset());
+		}
+	}
+
+	return nullptr;
+}
+
 inline TArray<TSharedPtr<FJsonValue>> RequestExports(const FString& Path)
 {
 	TArray<TSharedPtr<FJsonValue>> Exports = {};
@@ -0,0 +1,37 @@
+// Copyright JAA Contributors 2024-2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Dom/JsonValue.h"
+#include "Serialization/JsonReader.h"
+
+/*
+ * Json reader reading straight from a file on disk.
+ *
+ * The file is decoded from UTF-8 while it is read, only a small buffer of it is
+ * kept in memory. The reader owns the file, it is closed when the reader goes away.
+ */
+class FJsonFileReader : public TJsonReader<TCHAR> {
+public:
+	/* Null when the file can't be opened */
+	static TSharedPtr<FJsonFileReader> Create(const FString& File);
+
+private:
+	explicit FJsonFileReader(FArchive* InArchive);
+
+	TUniquePtr<FArchive> Archive;
+};
+
+/* Token level helpers, for reading parts of exported files without parsing all of them */
+class JSONASASSET_API FJsonStreamUtilities {
+public:
+	/* Reads the value starting at Notation, the same way FJsonSerializer builds it */
+	static TSharedPtr<FJsonValue> ReadValue(TJsonReader<TCHAR>& Reader, EJsonNotation Notation);
+
+	/* Steps over the value starting at Notation without building it */
+	static bool SkipValue(TJsonReader<TCHAR>& Reader, EJsonNotation Notation);
+
+	/* Type and name of the first export of a file, only the start of the file is read */
+	static bool ReadFirstExportHeader(const FString& File, FString& OutType, FString& OutName);
+};
@@ -24,4 +24,14 @@ struct FExportData {
 	FName Type;
 	FName Outer;
 	FJsonObject* Json;
-};
\ No newline at end of file
+};
+
+/* Whether parsed Json can be read from worker threads, used to pick the mode of a ParallelFor */
+inline bool CanReadJsonOffGameThread() {
+#if ENGINE_MAJOR_VERSION >= 5
+	return true;
+#else
+	// Json values are reference counted without thread safety on UE4
+	return false;
+#endif
+}
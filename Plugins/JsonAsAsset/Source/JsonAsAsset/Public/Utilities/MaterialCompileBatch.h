@@ -0,0 +1,81 @@
+// Copyright JAA Contributors 2024-2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "MaterialShared.h"
+
+class UMaterial;
+class UMaterialFunction;
+class UMaterialInterface;
+class UMaterialInstanceConstant;
+class UPackage;
+
+/*
+ * Scope that holds back material recompiles while an import batch runs.
+ *
+ * Materials, material functions and material instances created inside the
+ * scope skip their PostEditChange, and are all updated once when the outermost
+ * scope ends. Materials and instances compile under a single FMaterialUpdateContext. Parents are compiled before
+ * the instances that use them, so every shader map compiles once per batch.
+ * Their packages are saved after they are compiled, not before.
+ *
+ * Parents of material instances are resolved once per batch, instances sharing
+ * a parent reuse it instead of resolving the same chain again.
+ */
+class FMaterialCompileBatch {
+public:
+	FMaterialCompileBatch();
+	~FMaterialCompileBatch();
+
+	static bool IsActive();
+
+	/* Holds back PostEditChange of a material asset, returns false when it has to run now */
+	static bool Defer(UObject* Asset);
+
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 2
+	/* Holds back the static permutation update of a material instance */
+	static bool DeferStaticPermutation(UMaterialInstanceConstant* MaterialInstance, const FStaticParameterSet& StaticParameters);
+
+	/* Static parameters of a resolved parent chain, false while the chain still has a permutation pending */
+	static bool GetParentStaticParameters(UMaterialInterface* Parent, FStaticParameterSet& OutStaticParameters);
+#endif
+
+	/* Parent resolved earlier in the batch, parents that failed to resolve or went away are loaded again */
+	static bool FindParent(const FString& ObjectPath, UMaterialInterface*& OutParent);
+	static void AddParent(const FString& ObjectPath, UMaterialInterface* Parent);
+
+	/* Instance keeps the shader maps of its parent, it is initialized without a PostEditChange */
+	static void SkipRecompile(UMaterialInstanceConstant* MaterialInstance);
+
+	/* Holds back the save of a package with a material asset in it, until the batch compiled it */
+	static bool DeferSave(UPackage* Package);
+
+private:
+	static void Flush();
+
+	struct FPendingInstance {
+		TWeakObjectPtr<UMaterialInstanceConstant> MaterialInstance;
+
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 2
+		TOptional<FStaticParameterSet> StaticParameters;
+#endif
+
+		bool bSkipRecompile = false;
+	};
+
+	static int32 Depth;
+
+	static TArray<TWeakObjectPtr<UMaterialFunction>> PendingFunctions;
+	static TArray<TWeakObjectPtr<UMaterial>> PendingMaterials;
+	static TArray<FPendingInstance> PendingInstances;
+	static TArray<TWeakObjectPtr<UPackage>> PendingPackages;
+
+	static TMap<FString, TWeakObjectPtr<UMaterialInterface>> Parents;
+
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 2
+	static TMap<TWeakObjectPtr<UMaterialInterface>, FStaticParameterSet> ParentStaticParameters;
+#endif
+
+	static FPendingInstance& FindOrAddInstance(UMaterialInstanceConstant* MaterialInstance);
+};
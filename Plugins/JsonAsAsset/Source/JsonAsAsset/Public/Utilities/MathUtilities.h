@@ -24,4 +24,7 @@ public:
 	static FLightingChannels ObjectToLightingChannels(const FJsonObject* Object);
 	static FFloatInterval ObjectToFloatInterval(const FJsonObject* Object);
 	static FRichCurveKey ObjectToRichCurveKey(const TSharedPtr<FJsonObject>& Object);
+
+	/* Every key of a curve in time order, ready to be assigned at once. Sorted only when the export isn't */
+	static void ObjectsToRichCurveKeys(const TArray<TSharedPtr<FJsonValue>>& Objects, TArray<FRichCurveKey>& OutKeys);
 };
\ No newline at end of file
@@ -30,6 +30,24 @@ public:
     FObjectCompareSettings GetObjectSettings(int32 ObjectIndex) const;
 };
 
+/** Property value decoded from json ahead of time, written into its object later on the game thread */
+struct JSONASASSET_API FPropertyWrite {
+    FProperty* Property = nullptr;
+    int32 ArrayIndex = 0;
+
+    /** Decoded value owned by the write, null when the value can only be deserialized on the game thread */
+    void* Value = nullptr;
+    TSharedPtr<FJsonValue> JsonValue;
+
+    FPropertyWrite() = default;
+    FPropertyWrite(FPropertyWrite&& Other);
+    FPropertyWrite& operator=(FPropertyWrite&& Other);
+    ~FPropertyWrite();
+
+    FPropertyWrite(const FPropertyWrite&) = delete;
+    FPropertyWrite& operator=(const FPropertyWrite&) = delete;
+};
+
 UCLASS()
 class JSONASASSET_API UObjectSerializer : public UObject {
     GENERATED_BODY()
@@ -74,6 +92,14 @@ public:
 
     void FlushPropertiesIntoObject(const int32 ObjectIndex, UObject* Object, bool bVerifyNameAndRename, bool bVerifyOuterAndMove);
     void DeserializeObjectProperties(const TSharedPtr<FJsonObject>& Properties, UObject* Object);
+
+    /**
+     * Two phase version of DeserializeObjectProperties
+     * DecodeObjectProperties only reads the object and can run on worker threads, values that load
+     * or import assets are kept as json. ApplyObjectProperties then writes everything on the game thread
+     */
+    void DecodeObjectProperties(const TSharedPtr<FJsonObject>& Properties, UObject* Object, TArray<FPropertyWrite>& OutWrites) const;
+    void ApplyObjectProperties(TArray<FPropertyWrite>& Writes, const TSharedPtr<FJsonObject>& Properties, UObject* Object);
     void SetPropertySerializer(UPropertySerializer* NewPropertySerializer);
 
     void InitializeForSerialization(UPackage* NewSourcePackage);
@@ -118,4 +144,7 @@ private:
 
     UObject* DeserializeImportedObject(TSharedPtr<FJsonObject> ObjectJson);
     UObject* DeserializeExportedObject(int32 ObjectIndex, TSharedPtr<FJsonObject> ObjectJson);
+
+    void DecodePropertyWrite(FProperty* Property, int32 ArrayIndex, const TSharedPtr<FJsonValue>& JsonValue, UObject* Object, TArray<FPropertyWrite>& OutWrites) const;
+    void DeserializeStaticMeshLODData(const TSharedPtr<FJsonObject>& Properties, UObject* Object);
 };
\ No newline at end of file
@@ -6,6 +6,7 @@
 #include "Dom/JsonObject.h"
 #include "UObject/Object.h"
 #include "UObject/UnrealType.h"
+#include "GameplayTagContainer.h"
 #include "PropertyUtilities.generated.h"
 
 class UObjectSerializer;
@@ -68,6 +69,47 @@ public:
 	virtual bool Compare(UScriptStruct* Struct, const TSharedPtr<FJsonObject> JsonValue, const void* StructData, const TSharedPtr<FObjectCompareContext> Context) override;
 };
 
+/** Reads and writes the known fields of a plain struct straight into its memory, without going through reflection */
+template <typename T>
+class TNativeStructSerializer : public FStructSerializer
+{
+public:
+	virtual void Serialize(UScriptStruct* Struct, const TSharedPtr<FJsonObject> JsonValue, const void* StructData, TArray<int32>* OutReferencedSubobjects) override {
+		Write(*static_cast<const T*>(StructData), JsonValue);
+	}
+
+	virtual void Deserialize(UScriptStruct* Struct, void* StructData, const TSharedPtr<FJsonObject> JsonValue) override {
+		Read(JsonValue, *static_cast<T*>(StructData));
+	}
+
+	virtual bool Compare(UScriptStruct* Struct, const TSharedPtr<FJsonObject> JsonValue, const void* StructData, const TSharedPtr<FObjectCompareContext> Context) override {
+		/* Fields missing from the json keep their current value, like the fallback serializer */
+		T DeserializedValue = *static_cast<const T*>(StructData);
+		Read(JsonValue, DeserializedValue);
+
+		return Struct->CompareScriptStruct(StructData, &DeserializedValue, PPF_None);
+	}
+
+	static void Read(const TSharedPtr<FJsonObject>& JsonValue, T& OutValue);
+	static void Write(const T& Value, const TSharedPtr<FJsonObject>& JsonValue);
+};
+
+/*
+ * Scope around an import, gameplay tags requested while it is active are cached
+ * and forgotten when the outermost scope ends. Outside of a scope nothing is cached,
+ * so tags added or removed between imports are always seen.
+ */
+class JSONASASSET_API FGameplayTagCacheScope {
+public:
+	FGameplayTagCacheScope();
+	~FGameplayTagCacheScope();
+
+	static bool IsActive();
+
+private:
+	static int32 Depth;
+};
+
 UCLASS()
 class JSONASASSET_API UPropertySerializer : public UObject
 {
@@ -84,6 +126,9 @@ class JSONASASSET_API UPropertySerializer : public UObject
 
 	TSharedPtr<FStructSerializer> FallbackStructSerializer;
 	TMap<UScriptStruct*, TSharedPtr<FStructSerializer>> StructSerializers;
+
+	/* Valid tags requested inside a FGameplayTagCacheScope, shared by every serializer since each importer makes its own */
+	static TMap<FString, FGameplayTag> GameplayTags;
 	
 public:
 	UPropertySerializer();
@@ -93,6 +138,9 @@ public:
 	TArray<FFailedPropertyInfo> FailedProperties;
 	void ClearCachedData();
 
+	/** Forgets the cached tags, called when the outermost FGameplayTagCacheScope ends */
+	static void ClearGameplayTags();
+
 	/** Disables property serialization entirely */
 	void DisablePropertySerialization(UStruct* Struct, FName PropertyName);
 	void AddStructSerializer(UScriptStruct* Struct, const TSharedPtr<FStructSerializer>& Serializer);
@@ -100,6 +148,10 @@ public:
 	/** Checks whenever we should serialize property in question at all */
 	bool ShouldSerializeProperty(FProperty* Property) const;
 
+	/** Checks whenever values of this property can be deserialized off the game thread, they must not load or import anything */
+	bool CanDeserializeOffGameThread(FProperty* Property) const;
+	bool CanDeserializeOffGameThread(UScriptStruct* Struct) const;
+
 	TSharedRef<FJsonValue> SerializePropertyValue(FProperty* Property, const void* Value, TArray<int32>* OutReferencedSubobjects = NULL);
 	TSharedRef<FJsonObject> SerializeStruct(UScriptStruct* Struct, const void* Value, TArray<int32>* OutReferencedSubobjects = NULL);
 
@@ -112,46 +164,52 @@ public:
 
 private:
 	FStructSerializer* GetStructSerializer(UScriptStruct* Struct) const;
+	static FGameplayTag RequestGameplayTag(const FString& TagName);
+	bool CanDeserializeOffGameThread(FProperty* Property, TArray<UScriptStruct*>& VisitedStructs) const;
+	bool CanDeserializeOffGameThread(UScriptStruct* Struct, TArray<UScriptStruct*>& VisitedStructs) const;
 	bool ComparePropertyValuesInner(FProperty* Property, const TSharedRef<FJsonValue>& JsonValue, const void* CurrentValue, const TSharedPtr<FObjectCompareContext> Context);
 	TSharedRef<FJsonValue> SerializePropertyValueInner(FProperty* Property, const void* Value, TArray<int32>* OutReferencedSubobjects);
 };
 
-/* Use to handle differentiating formats produced by CUE4Parse */
-inline bool PassthroughPropertyHandler(FProperty* Property, const FString& PropertyName, void* PropertyValue, const TSharedPtr<FJsonObject>& Properties, UPropertySerializer* PropertySerializer) {
-	/* Handles static arrays in the format of: PropertyName[Index] */
-	if (Property->ArrayDim != 1) {
-		TArray<TSharedPtr<FJsonValue>> ArrayElements;
+/* Finds static array elements with the format: PropertyName[Index] and sets them properly into an array */
+inline void CollectStaticArrayElements(const FString& PropertyName, const TSharedPtr<FJsonObject>& Properties, TArray<TSharedPtr<FJsonValue>>& ArrayElements) {
+	for (const auto& Pair : Properties->Values) {
+		const FString& Key = Pair.Key;
+		TSharedPtr<FJsonValue> Value = Pair.Value;
 
-		/* Finds array elements with the format: PropertyName[Index] and sets them properly into an array */
-		for (const auto& Pair : Properties->Values) {
-			const FString& Key = Pair.Key;
-			TSharedPtr<FJsonValue> Value = Pair.Value;
+		/* If it doesn't start with the same property name */
+		if (!Key.StartsWith(PropertyName)) continue;
 
-			/* If it doesn't start with the same property name */
-			if (!Key.StartsWith(PropertyName)) continue;
+		/* By default, it should be 0 */
+		int32 CurrentArrayIndex = 0;
 
-			/* By default, it should be 0 */
-			int32 CurrentArrayIndex = 0;
+		/* If it is formatted like PropertyName[Index] */
+		if (Key.Contains("[") && Key.Contains("]")) {
+			int32 OpenBracketPos, CloseBracketPos;
 
-			/* If it is formatted like PropertyName[Index] */
-			if (Key.Contains("[") && Key.Contains("]")) {
-				int32 OpenBracketPos, CloseBracketPos;
-
-				/* Find the index in PropertyName[Index] (integer) */
-				if (Key.FindChar('[', OpenBracketPos) && Key.FindChar(']', CloseBracketPos) && CloseBracketPos > OpenBracketPos) {
-					FString IndexStr = Key.Mid(OpenBracketPos + 1, CloseBracketPos - OpenBracketPos - 1);
-					
-					CurrentArrayIndex = FCString::Atoi(*IndexStr);
-				}
+			/* Find the index in PropertyName[Index] (integer) */
+			if (Key.FindChar('[', OpenBracketPos) && Key.FindChar(']', CloseBracketPos) && CloseBracketPos > OpenBracketPos) {
+				FString IndexStr = Key.Mid(OpenBracketPos + 1, CloseBracketPos - OpenBracketPos - 1);
+				
+				CurrentArrayIndex = FCString::Atoi(*IndexStr);
 			}
+		}
 
-			/* Fail-save? */
-			if (CurrentArrayIndex >= ArrayElements.Num()) {
-				ArrayElements.SetNum(CurrentArrayIndex + 1);
-			}
-			
-			ArrayElements[CurrentArrayIndex] = Value;
+		/* Fail-save? */
+		if (CurrentArrayIndex >= ArrayElements.Num()) {
+			ArrayElements.SetNum(CurrentArrayIndex + 1);
 		}
+		
+		ArrayElements[CurrentArrayIndex] = Value;
+	}
+}
+
+/* Use to handle differentiating formats produced by CUE4Parse */
+inline bool PassthroughPropertyHandler(FProperty* Property, const FString& PropertyName, void* PropertyValue, const TSharedPtr<FJsonObject>& Properties, UPropertySerializer* PropertySerializer) {
+	/* Handles static arrays in the format of: PropertyName[Index] */
+	if (Property->ArrayDim != 1) {
+		TArray<TSharedPtr<FJsonValue>> ArrayElements;
+		CollectStaticArrayElements(PropertyName, Properties, ArrayElements);
 
 		/* Array elements is filled up, now we set them in the property value */
 		for (int32 ArrayIndex = 0; ArrayIndex < ArrayElements.Num(); ArrayIndex++) {
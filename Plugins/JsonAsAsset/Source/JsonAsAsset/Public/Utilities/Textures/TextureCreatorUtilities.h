@@ -19,7 +19,8 @@ public:
 		GObjectSerializer->SetPropertySerializer(PropertySerializer);
 	}
 
-	bool CreateTexture2D(UTexture*& OutTexture2D, TArray<uint8>& Data, const TSharedPtr<FJsonObject>& Properties) const;
+	/* DecodedData can be supplied by a batch import that already decoded the payload, see DecodeTexture2D */
+	bool CreateTexture2D(UTexture*& OutTexture2D, TArray<uint8>& Data, const TSharedPtr<FJsonObject>& Properties, const TArray<uint8>* DecodedData = nullptr) const;
 	bool CreateTextureCube(UTexture*& OutTextureCube, const TArray<uint8>& Data, const TSharedPtr<FJsonObject>& Properties) const;
 	bool CreateVolumeTexture(UTexture*& OutVolumeTexture, TArray<uint8>& Data, const TSharedPtr<FJsonObject>& Properties) const;
 	bool CreateRenderTarget2D(UTexture*& OutRenderTarget2D, const TSharedPtr<FJsonObject>& Properties) const;
@@ -28,8 +29,19 @@ public:
 	
 	bool DeserializeTexture(UTexture* Texture, const TSharedPtr<FJsonObject>& Properties) const;
 
+	/* Reads the PixelFormat of a texture export, must be called on the game thread */
+	static EPixelFormat GetPixelFormat(const TSharedPtr<FJsonObject>& Properties);
+
+	/* Size in bytes of the decoded source of a Texture2D */
+	static int GetTexture2DDecodedSize(const EPixelFormat Format, const int SizeX, const int SizeY, const int DataSize);
+
+	/* Decodes a Texture2D payload ahead of creation, safe to call from worker threads */
+	static bool DecodeTexture2D(TArray<uint8>& Data, const TSharedPtr<FJsonObject>& Properties, const EPixelFormat Format, TArray<uint8>& OutDecodedData);
+
 private:
-	static void GetDecompressedTextureData(uint8* Data, uint8*& OutData, const int SizeX, const int SizeY, const int SizeZ, const int TotalSize, const EPixelFormat Format);
+	/* Decodes through FTextureDecodeCache, identical payloads are only decoded once. False for unsupported formats */
+	static bool GetDecompressedTextureData(uint8* Data, const int DataSize, uint8*& OutData, const int SizeX, const int SizeY, const int SizeZ, const int TotalSize, const EPixelFormat Format);
+	static bool DecodeTextureData(uint8* Data, uint8*& OutData, const int SizeX, const int SizeY, const int SizeZ, const int TotalSize, const EPixelFormat Format);
 
 protected:
 	FString FileName;
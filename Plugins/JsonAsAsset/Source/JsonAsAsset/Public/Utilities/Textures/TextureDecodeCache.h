@@ -0,0 +1,90 @@
+// Copyright JAA Contributors 2024-2025
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PixelFormat.h"
+#include "Containers/List.h"
+#include "HAL/ThreadSafeCounter64.h"
+
+/*
+ * Identifies a decoded texture payload by a hash of the compressed bytes,
+ * the pixel format and the dimensions it was decoded with.
+ */
+struct FTextureDecodeKey
+{
+	uint64 PayloadHash = 0;
+	int32 PayloadSize = 0;
+	int32 SizeX = 0;
+	int32 SizeY = 0;
+	int32 SizeZ = 0;
+	EPixelFormat Format = PF_Unknown;
+
+	bool operator==(const FTextureDecodeKey& Other) const
+	{
+		return PayloadHash == Other.PayloadHash &&
+			   PayloadSize == Other.PayloadSize &&
+			   SizeX == Other.SizeX &&
+			   SizeY == Other.SizeY &&
+			   SizeZ == Other.SizeZ &&
+			   Format == Other.Format;
+	}
+
+	friend uint32 GetTypeHash(const FTextureDecodeKey& Key)
+	{
+		return HashCombine(HashCombine(GetTypeHash(Key.PayloadHash), GetTypeHash(Key.PayloadSize)),
+			HashCombine(GetTypeHash(Key.SizeX * 31 + Key.SizeY * 17 + Key.SizeZ), GetTypeHash(static_cast<uint8>(Key.Format))));
+	}
+};
+
+/*
+ * Process-wide cache of decoded texture data.
+ *
+ * Re-importing materials (or importing several games sharing the same base content)
+ * fetches the same compressed payloads over and over, this keeps the decoded result
+ * around so identical payloads skip decoding entirely.
+ */
+class JSONASASSET_API FTextureDecodeCache
+{
+public:
+	/* Builds the lookup key for a compressed payload */
+	static FTextureDecodeKey MakeKey(const uint8* Data, int32 DataSize, int32 SizeX, int32 SizeY, int32 SizeZ, EPixelFormat Format);
+
+	/* Copies a cached decode into OutData if one exists, returns false on a miss */
+	static bool Find(const FTextureDecodeKey& Key, uint8* OutData, int32 TotalSize);
+
+	/* Stores a decoded result, evicting the oldest entries when over budget */
+	static void Add(const FTextureDecodeKey& Key, const uint8* DecodedData, int32 TotalSize);
+
+	/* Drops every cached entry, counters are left untouched */
+	static void Empty();
+
+	static int64 GetHits() { return Hits.GetValue(); }
+	static int64 GetMisses() { return Misses.GetValue(); }
+	static int64 GetCachedBytes();
+
+	static void ResetCounters();
+
+	/* Upper bound of decoded bytes kept alive by the cache */
+	static constexpr int64 MaxCachedBytes = 512ll * 1024 * 1024;
+
+private:
+	using FInsertionOrder = TDoubleLinkedList<FTextureDecodeKey>;
+
+	/* A decoded payload and its place in the insertion order, so it is unlinked without searching */
+	struct FEntry
+	{
+		TArray<uint8> Data;
+		FInsertionOrder::TDoubleLinkedListNode* Node = nullptr;
+	};
+
+	static FCriticalSection CriticalSection;
+	static TMap<FTextureDecodeKey, FEntry> Entries;
+
+	/* Oldest entry at the head, evicted first */
+	static FInsertionOrder InsertionOrder;
+	static int64 CachedBytes;
+
+	static FThreadSafeCounter64 Hits;
+	static FThreadSafeCounter64 Misses;
+};